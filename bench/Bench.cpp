@@ -0,0 +1,536 @@
+#include "EntityStore.hpp"
+#include "ProjectileSystem.hpp"
+#include "ZombieSystem.hpp"
+#include "ThreadPool.hpp"
+#include "PackedBounds.hpp"
+#include "SpatialGrid.hpp"
+#include "StaticCollisionWorld.hpp"
+#include "Constants.hpp"
+#include "CpuFeatures.hpp"
+#include "Microbench.hpp"
+#include "BenchExtents.hpp"
+#include "ScriptedInput.hpp"
+#include "Simulation.hpp"
+#include "SimulationThread.hpp"
+#include "TripleBuffer.hpp"
+#include <SFML/Graphics/Sprite.hpp>
+#include <atomic>
+#include <memory>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct Scene {
+    std::vector<sf::FloatRect> bullets;
+    std::vector<sf::FloatRect> zombies;
+};
+
+static Scene makeScene(int entityCount, unsigned int seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> coord(0.0f, WORLD_SIZE);
+
+    Scene scene;
+    for (int i = 0; i < entityCount / 2; ++i)
+        scene.bullets.emplace_back(sf::Vector2f(coord(rng), coord(rng)), BULLET_EXTENT);
+    for (int i = 0; i < entityCount - entityCount / 2; ++i)
+        scene.zombies.emplace_back(sf::Vector2f(coord(rng), coord(rng)), ZOMBIE_EXTENT);
+    return scene;
+}
+
+// Same loop shape as the original Game::checkCollisions: every bullet against every zombie
+static int nestedLoops(const Scene& scene) {
+    int hits = 0;
+    for (const auto& bullet : scene.bullets) {
+        for (const auto& zombie : scene.zombies) {
+            if (bullet.intersects(zombie)) {
+                hits++;
+                break;
+            }
+        }
+    }
+    return hits;
+}
+
+static int gridBroadphase(const Scene& scene, SpatialGrid& grid, std::vector<int>& candidates) {
+    int hits = 0;
+    grid.build(scene.zombies);
+    for (const auto& bullet : scene.bullets) {
+        grid.query(bullet, candidates);
+        for (int index : candidates) {
+            if (bullet.intersects(scene.zombies[index])) {
+                hits++;
+                break;
+            }
+        }
+    }
+    return hits;
+}
+
+template <typename Fn>
+static double timeMs(int iterations, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) fn();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / iterations;
+}
+
+static void benchCollisionGrid() {
+    std::printf("collision broadphase: nested loops vs SpatialGrid (cell %.0f)\n", COLLISION_CELL_SIZE);
+    std::printf("%10s %14s %14s %10s %8s\n", "entities", "nested ms", "grid ms", "speedup", "hits");
+
+    SpatialGrid grid(sf::FloatRect(0, 0, WORLD_SIZE, WORLD_SIZE), COLLISION_CELL_SIZE);
+    std::vector<int> candidates;
+
+    for (int entityCount : { 100, 1000, 10000 }) {
+        Scene scene = makeScene(entityCount, 1234u);
+        int iterations = entityCount >= 10000 ? 5 : 200;
+
+        int nestedHits = 0, gridHits = 0;
+        double nested = timeMs(iterations, [&] { nestedHits = nestedLoops(scene); });
+        double gridded = timeMs(iterations, [&] { gridHits = gridBroadphase(scene, grid, candidates); });
+
+        if (nestedHits != gridHits)
+            std::printf("MISMATCH: nested %d hits, grid %d hits\n", nestedHits, gridHits);
+
+        std::printf("%10d %14.4f %14.4f %9.1fx %8d\n", entityCount, nested, gridded, nested / gridded, gridHits);
+    }
+}
+
+// Per-zombie obstacle check: the old linear scan against the AABB tree
+static void benchStaticWorld() {
+    std::printf("static obstacle queries: linear scan vs StaticCollisionWorld, 1000 zombie probes\n");
+    std::printf("%10s %14s %14s %10s\n", "obstacles", "linear ms", "tree ms", "speedup");
+
+    std::mt19937 rng(99u);
+    std::uniform_real_distribution<float> coord(0.0f, WORLD_SIZE);
+
+    std::vector<sf::FloatRect> probes;
+    for (int i = 0; i < 1000; ++i)
+        probes.emplace_back(sf::Vector2f(coord(rng), coord(rng)), ZOMBIE_EXTENT);
+
+    for (int obstacleCount : { 10, 100, 1000, 10000 }) {
+        std::vector<sf::FloatRect> obstacles;
+        for (int i = 0; i < obstacleCount; ++i)
+            obstacles.emplace_back(coord(rng), coord(rng), 15.0f, 6.0f);
+
+        StaticCollisionWorld world;
+        world.build(obstacles);
+
+        int linearHits = 0, treeHits = 0;
+        double linear = timeMs(20, [&] {
+            linearHits = 0;
+            for (const auto& probe : probes) {
+                for (const auto& obstacle : obstacles) {
+                    if (probe.intersects(obstacle)) {
+                        linearHits++;
+                        break;
+                    }
+                }
+            }
+        });
+        double tree = timeMs(20, [&] {
+            treeHits = 0;
+            for (const auto& probe : probes)
+                if (world.overlaps(probe)) treeHits++;
+        });
+
+        if (linearHits != treeHits)
+            std::printf("MISMATCH: linear %d hits, tree %d hits\n", linearHits, treeHits);
+
+        std::printf("%10d %14.4f %14.4f %9.1fx\n", obstacleCount, linear, tree, linear / tree);
+    }
+}
+
+// Stand-in for the old polymorphic Bullet: vtable, sprite-sized body and a direction.
+// Same size as the removed class, so the loop touches the same number of cache lines.
+struct LegacyBullet {
+    virtual ~LegacyBullet() = default;
+    virtual void update(float deltaTime) { position += direction * BULLET_SPEED * 0.6f * deltaTime; }
+
+    sf::Vector2f position;
+    unsigned char spriteBody[sizeof(sf::Sprite) - sizeof(sf::Vector2f)];
+    sf::Vector2f direction;
+};
+
+static void benchEntityLayout() {
+    const size_t projectileBytes = sizeof(sf::Vector2f) * 3 + sizeof(float) + sizeof(TextureId);
+    const size_t zombieBytes = sizeof(sf::Vector2f) * 2 + sizeof(float) * 4 + sizeof(int) + sizeof(uint32_t) + sizeof(TextureId);
+    const size_t powerUpBytes = sizeof(sf::Vector2f) + sizeof(PowerUp::Type) + sizeof(TextureId);
+
+    std::printf("entity layout: per-object AoS vs EntityStore SoA\n");
+    std::printf("  bytes per projectile: %zu (legacy %zu)\n", projectileBytes, sizeof(LegacyBullet));
+    std::printf("  bytes per zombie:     %zu\n", zombieBytes);
+    std::printf("  bytes per power-up:   %zu\n", powerUpBytes);
+
+    const int count = 10000;
+    const float tick = 1.0f / SIM_TICK_RATE;
+
+    std::vector<std::unique_ptr<LegacyBullet>> legacy;
+    ProjectilePool projectiles(count, ProjectilePool::DropPolicy::DropNewest);
+    sf::FloatRect unbounded(-1e9f, -1e9f, 2e9f, 2e9f);
+    std::mt19937 rng(7u);
+    std::uniform_real_distribution<float> coord(0.0f, WORLD_SIZE);
+    for (int i = 0; i < count; ++i) {
+        sf::Vector2f position(coord(rng), coord(rng));
+        sf::Vector2f direction(0.6f, 0.8f);
+        legacy.emplace_back(new LegacyBullet());
+        legacy.back()->position = position;
+        legacy.back()->direction = direction;
+        projectiles.add(position, direction * BULLET_SPEED * 0.6f, 1e9f, TextureId::Bullet);
+    }
+
+    double aos = timeMs(1000, [&] { for (auto& bullet : legacy) bullet->update(tick); });
+    double soa = timeMs(1000, [&] { updateProjectiles(projectiles, tick, unbounded); });
+
+    std::printf("  update %d projectiles: legacy %.4f ms, SoA %.4f ms (%.1fx)\n", count, aos, soa, aos / soa);
+}
+
+// One simulated hour of sustained fire into a capped pool: size must plateau and tick cost stay flat
+static void benchProjectileSoak() {
+    const float tick = 1.0f / SIM_TICK_RATE;
+    const int ticksPerMinute = static_cast<int>(SIM_TICK_RATE * 60);
+    const int spawnsPerTick = 8;
+    sf::FloatRect worldBounds(0, 0, WORLD_SIZE, WORLD_SIZE);
+
+    ProjectilePool pool(ZOMBIE_BULLET_CAPACITY, ProjectilePool::DropPolicy::DropNewest);
+    std::mt19937 rng(3u);
+    std::uniform_real_distribution<float> coord(0.0f, WORLD_SIZE);
+    std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+
+    std::printf("projectile soak: %d spawns/tick for 60 simulated minutes, capacity %zu\n", spawnsPerTick, pool.getCapacity());
+    std::printf("%8s %10s %12s %14s\n", "minute", "live", "dropped", "us per tick");
+
+    size_t reservedBytes = pool.position.capacity() * sizeof(sf::Vector2f);
+    for (int minute = 1; minute <= 60; ++minute) {
+        double ms = timeMs(ticksPerMinute, [&] {
+            for (int s = 0; s < spawnsPerTick; ++s) {
+                float a = angle(rng);
+                pool.add(sf::Vector2f(coord(rng), coord(rng)), sf::Vector2f(std::cos(a), std::sin(a)) * BULLET_SPEED * 0.3f,
+                    PROJECTILE_TTL, TextureId::ZombieBullet);
+            }
+            updateProjectiles(pool, tick, worldBounds);
+        });
+        if (minute == 1 || minute % 10 == 0)
+            std::printf("%8d %10zu %12zu %14.3f\n", minute, pool.size(), pool.getDropped(), ms * 1000.0);
+    }
+
+    if (pool.position.capacity() * sizeof(sf::Vector2f) != reservedBytes)
+        std::printf("FAIL: pool storage grew during the soak\n");
+}
+
+// One bullet against every zombie of a crowd until the first hit: sf::FloatRect::intersects one
+// pair at a time vs PackedBounds 8 boxes at a time, at every SIMD level. Hits must agree;
+// returns true if they did not
+static bool benchNarrowphase() {
+    const int bulletCount = 10000;
+    std::printf("narrowphase: %d bullets, first hit among N candidates, ns per bullet\n", bulletCount);
+    std::printf("%10s %10s", "candidates", "FloatRect");
+    const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2 };
+    for (SimdLevel level : levels)
+        if (level <= detectSimdLevel()) std::printf(" %10s", getSimdLevelName(level));
+    std::printf(" %8s\n", "hits");
+
+    bool failed = false;
+    for (int candidateCount : { 8, 64, 512 }) {
+        // Zombies spread so that most bullets hit nothing and scan the whole list
+        std::mt19937 rng(5u);
+        float crowdSize = std::sqrt(static_cast<float>(candidateCount)) * ZOMBIE_EXTENT.x * 4;
+        std::uniform_real_distribution<float> coord(0.0f, crowdSize);
+        std::vector<sf::FloatRect> zombies;
+        std::vector<int> candidates;
+        for (int i = 0; i < candidateCount; ++i) {
+            zombies.emplace_back(sf::Vector2f(coord(rng), coord(rng)), ZOMBIE_EXTENT);
+            candidates.push_back(i);
+        }
+        std::vector<sf::FloatRect> bullets;
+        for (int i = 0; i < bulletCount; ++i)
+            bullets.emplace_back(sf::Vector2f(coord(rng), coord(rng)), BULLET_EXTENT);
+
+        long long expected = 0;
+        int hits = 0;
+        double pairwise = timeMs(20, [&] {
+            expected = 0;
+            hits = 0;
+            for (const auto& bullet : bullets) {
+                for (int index : candidates) {
+                    if (bullet.intersects(zombies[index])) {
+                        expected += index;
+                        hits++;
+                        break;
+                    }
+                }
+            }
+        });
+        std::printf("%10d %10.1f", candidateCount, pairwise * 1e6 / bulletCount);
+
+        bool same = true;
+        for (SimdLevel level : levels) {
+            if (level > detectSimdLevel()) break;
+            setSimdLevel(level);
+            PackedBounds boxes;
+            boxes.clear();
+            for (const auto& zombie : zombies) boxes.add(zombie);
+
+            long long found = 0;
+            double ms = timeMs(20, [&] {
+                found = 0;
+                for (const auto& bullet : bullets) {
+                    int hit = boxes.firstOverlap(bullet, candidates);
+                    if (hit >= 0) found += hit;
+                }
+            });
+            std::printf(" %10.1f", ms * 1e6 / bulletCount);
+            same = same && found == expected;
+        }
+        std::printf(" %8d%s\n", hits, same ? "" : " MISMATCH");
+        failed = failed || !same;
+    }
+    setSimdLevel(detectSimdLevel());
+    return failed;
+}
+
+// A million projectiles on one core at every SIMD level the CPU has; every level must end in the
+// same state as the scalar kernel. Returns true if one did not
+static bool benchProjectileKernel() {
+    const int count = 1000000;
+    const int ticks = 60;
+    const float tick = 1.0f / SIM_TICK_RATE;
+    const float areaSize = 8 * WORLD_SIZE;
+    sf::FloatRect area(0, 0, areaSize, areaSize);
+
+    ProjectilePool scene(count, ProjectilePool::DropPolicy::DropNewest);
+    std::mt19937 rng(11u);
+    std::uniform_real_distribution<float> coord(0.0f, areaSize);
+    std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+    std::uniform_real_distribution<float> lifetime(0.0f, PROJECTILE_TTL);
+    for (int i = 0; i < count; ++i) {
+        float a = angle(rng);
+        scene.add(sf::Vector2f(coord(rng), coord(rng)), sf::Vector2f(std::cos(a), std::sin(a)) * BULLET_SPEED * 0.6f,
+            lifetime(rng), TextureId::Bullet);
+    }
+
+    std::printf("projectile kernel: %d projectiles, %d ticks, one core (detected: %s)\n", count, ticks,
+        getSimdLevelName(detectSimdLevel()));
+    std::printf("%8s %12s %16s %10s\n", "level", "ms per tick", "projectiles/s", "live");
+
+    ProjectilePool reference = scene;
+    bool failed = false;
+    const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2 };
+    for (SimdLevel level : levels) {
+        if (level > detectSimdLevel()) break;
+        setSimdLevel(level);
+
+        ProjectilePool projectiles = scene;
+        double ms = timeMs(ticks, [&] { updateProjectiles(projectiles, tick, area); });
+        std::printf("%8s %12.3f %15.0fM %10zu", getSimdLevelName(level), ms, count / ms / 1000.0, projectiles.size());
+
+        if (level == SimdLevel::Scalar) reference = projectiles;
+        else if (projectiles.position != reference.position || projectiles.timeToLive != reference.timeToLive) {
+            std::printf(" MISMATCH");
+            failed = true;
+        }
+        std::printf("\n");
+    }
+    setSimdLevel(detectSimdLevel());
+    return failed;
+}
+
+// updateZombies over a fixed scene at 1/2/4/8 threads, then the largest scene at 8 threads across
+// chunk sizes around ZOMBIE_UPDATE_CHUNK; every run must match the serial one bit for bit.
+// Returns true if one did not
+static bool benchZombieThreads() {
+    const int ticks = 20;
+    const float tick = 1.0f / SIM_TICK_RATE;
+
+    std::printf("parallel zombie update: %d ticks, 100 obstacles, ms per tick (hardware threads: %u)\n",
+        ticks, std::thread::hardware_concurrency());
+    std::printf("%10s %10s %10s %10s %10s %10s\n", "zombies", "serial", "1 thread", "2 threads", "4 threads", "8 threads");
+
+    std::mt19937 rng(11u);
+    std::uniform_real_distribution<float> coord(0.0f, WORLD_SIZE);
+    std::vector<sf::FloatRect> obstacles;
+    for (int i = 0; i < 100; ++i)
+        obstacles.emplace_back(coord(rng), coord(rng), 150.0f, 62.0f);
+    StaticCollisionWorld world;
+    world.build(obstacles);
+    FlowField flowField(sf::FloatRect(0, 0, WORLD_SIZE, WORLD_SIZE), FLOW_FIELD_CELL_SIZE);
+    flowField.setObstacles(obstacles, ZOMBIE_EXTENT);
+    flowField.update(sf::Vector2f(WORLD_SIZE / 2, WORLD_SIZE / 2));
+
+    bool failed = false;
+    for (int zombieCount : { 1000, 10000, 100000 }) {
+        ZombieArchetype scene;
+        scene.extent = ZOMBIE_EXTENT;
+        for (int i = 0; i < zombieCount; ++i) {
+            spawnZombie(scene, sf::Vector2f(coord(rng), coord(rng)), rng);
+            scene.fireTimer.back() = std::uniform_real_distribution<float>(0.0f, scene.fireInterval.back())(rng);
+        }
+
+        ZombieArchetype zombies;
+        ProjectilePool bullets(ZOMBIE_BULLET_CAPACITY, ProjectilePool::DropPolicy::DropNewest);
+        bullets.extent = BULLET_EXTENT;
+
+        auto runTicks = [&](ThreadPool* threads, size_t chunkSize) {
+            ZombieWorkspace workspace;
+            workspace.threads = threads;
+            workspace.chunkSize = chunkSize;
+            zombies = scene;
+            bullets.clear();
+            auto start = std::chrono::steady_clock::now();
+            for (int t = 0; t < ticks; ++t)
+                updateZombies(zombies, tick, sf::Vector2f(WORLD_SIZE / 2, WORLD_SIZE / 2), bullets, world, flowField, workspace);
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / ticks;
+        };
+
+        auto matchesSerial = [&](const ZombieArchetype& expectedZombies, const std::vector<sf::Vector2f>& expectedBullets) {
+            bool same = zombies.position == expectedZombies.position && zombies.fireInterval == expectedZombies.fireInterval &&
+                zombies.randomState == expectedZombies.randomState && bullets.position == expectedBullets;
+            failed = failed || !same;
+            return same;
+        };
+
+        double serial = runTicks(nullptr, ZOMBIE_UPDATE_CHUNK);
+        ZombieArchetype expectedZombies = zombies;
+        std::vector<sf::Vector2f> expectedBullets = bullets.position;
+
+        std::printf("%10d %10.3f", zombieCount, serial);
+        for (unsigned int threadCount : { 1u, 2u, 4u, 8u }) {
+            ThreadPool threads(threadCount - 1);
+            double ms = runTicks(&threads, ZOMBIE_UPDATE_CHUNK);
+            std::printf(" %10.3f", ms);
+            if (!matchesSerial(expectedZombies, expectedBullets)) std::printf(" MISMATCH");
+        }
+        std::printf("\n");
+
+        // Smaller chunks balance better across threads but pay one task claim each
+        if (zombieCount == 100000) {
+            std::printf("%d zombies at 8 threads, serial %.1f us per %zu-zombie chunk\n",
+                zombieCount, serial * 1000.0 * ZOMBIE_UPDATE_CHUNK / zombieCount, ZOMBIE_UPDATE_CHUNK);
+            std::printf("%10s %10s %10s\n", "chunk", "tasks", "ms");
+            ThreadPool threads(7);
+            for (size_t chunkSize : { 64, 128, 256, 512, 1024, 4096 }) {
+                double ms = runTicks(&threads, chunkSize);
+                std::printf("%10zu %10zu %10.3f", chunkSize, (zombieCount + chunkSize - 1) / chunkSize, ms);
+                if (!matchesSerial(expectedZombies, expectedBullets)) std::printf(" MISMATCH");
+                std::printf("\n");
+            }
+        }
+    }
+    return failed;
+}
+
+// One thread publishes through a TripleBuffer as fast as it can while another reads it: every
+// value read must be whole (all fields from one publish) and never older than the one before.
+// Returns true if any read was not
+static bool benchTripleBuffer() {
+    struct Stamped {
+        unsigned long long fields[32];   // several cache lines, so a torn copy would show
+    };
+    const int reads = 20000000;
+
+    TripleBuffer<Stamped> buffer;
+    std::atomic<bool> done{ false };
+    unsigned long long published = 0;
+    std::thread writer([&] {
+        while (!done.load(std::memory_order_relaxed)) {
+            ++published;
+            for (unsigned long long& field : buffer.back().fields) field = published;
+            buffer.publish();
+        }
+    });
+
+    int torn = 0, backwards = 0, fresh = 0;
+    unsigned long long last = 0;
+    double ms = timeMs(1, [&] {
+        for (int i = 0; i < reads; ++i) {
+            if (buffer.update()) ++fresh;
+            const Stamped& value = buffer.front();
+            unsigned long long stamp = value.fields[0];
+            for (unsigned long long field : value.fields)
+                if (field != stamp) { ++torn; break; }
+            if (stamp < last) ++backwards;
+            last = stamp;
+        }
+    });
+    done = true;
+    writer.join();
+
+    std::printf("triple buffer: %d reads in %.1f ms, %d fresh of %llu published\n", reads, ms, fresh, published);
+    if (torn > 0) std::printf("FAIL: %d reads mixed fields from different publishes\n", torn);
+    if (backwards > 0) std::printf("FAIL: %d reads went back to an older value\n", backwards);
+    return torn > 0 || backwards > 0;
+}
+
+// Two restarts requested between the same pair of ticks, as pressing R and clicking Restart in
+// one event drain does: the simulation resets once, but the snapshot must still report both
+// requests as serviced, or the game would wait forever for a second reset that never comes.
+// Returns true on a failure
+static bool benchRestartRequests() {
+    bool failed = false;
+    for (bool threaded : { false, true }) {
+        Simulation sim(1u);
+        ScriptedInput script(static_cast<int>(SIM_TICK_RATE * 2));
+        SimulationThread simThread(sim);
+        simThread.setInput(&script, nullptr, nullptr);
+        simThread.start(threaded);
+        simThread.setRunning(true);
+
+        const float tick = 1.0f / SIM_TICK_RATE;
+        auto waitTicks = [&](int ticks) {
+            if (threaded) std::this_thread::sleep_for(std::chrono::duration<float>(ticks * tick));
+            else simThread.advance(ticks * tick);
+        };
+
+        waitTicks(10);
+        simThread.requestRestart();
+        simThread.requestRestart();
+        waitTicks(1);
+
+        // Threaded, give the simulation thread a generous while to get round to them
+        const WorldSnapshot* snapshot = &simThread.acquire();
+        for (int i = 0; i < 1000 && snapshot->restartRequests < 2; ++i) {
+            waitTicks(1);
+            snapshot = &simThread.acquire();
+        }
+        int requests = snapshot->restartRequests, restarts = snapshot->restarts;
+        simThread.stop();
+
+        std::printf("restart requests (%s): 2 requested, %d serviced, %d reset%s\n",
+            threaded ? "threaded" : "inline", requests, restarts, restarts == 1 ? "" : "s");
+        if (requests != 2) {
+            std::printf("FAIL: the snapshot does not report both requests as serviced\n");
+            failed = true;
+        }
+        // Threaded, the first request may already have been serviced when the second arrives
+        if (restarts != 1 && !(threaded && restarts == 2)) {
+            std::printf("FAIL: two requests between ticks should make exactly one reset\n");
+            failed = true;
+        }
+    }
+    return failed;
+}
+
+int main(int argc, char* argv[]) {
+    std::string only = argc > 1 ? argv[1] : "";
+
+    // Machine-readable regression suite; the cases below are one-off comparisons
+    if (only == "suite") return runSuite(argc - 2, argv + 2);
+
+    // Correctness checks fail the run, so CI catches them; timings never do
+    bool failed = false;
+    if (only.empty() || only == "grid") benchCollisionGrid();
+    if (only.empty() || only == "static") benchStaticWorld();
+    if (only.empty() || only == "layout") benchEntityLayout();
+    if (only.empty() || only == "soak") benchProjectileSoak();
+    if (only.empty() || only == "kernel") failed |= benchProjectileKernel();
+    if (only.empty() || only == "narrowphase") failed |= benchNarrowphase();
+    if (only.empty() || only == "threads") failed |= benchZombieThreads();
+    if (only.empty() || only == "triplebuffer") failed |= benchTripleBuffer();
+    if (only.empty() || only == "restarts") failed |= benchRestartRequests();
+
+    return failed ? 1 : 0;
+}
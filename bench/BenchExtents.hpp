@@ -0,0 +1,13 @@
+#ifndef BENCHEXTENTS_HPP
+#define BENCHEXTENTS_HPP
+
+#include <SFML/System/Vector2.hpp>
+
+// Collision sizes of the scaled game images (player.png * 0.25, bullet.png * 0.1, ...), shared
+// by bench and bench_sim so both measure the same geometry
+const sf::Vector2f PLAYER_EXTENT(72.0f, 73.75f);
+const sf::Vector2f BULLET_EXTENT(7.6f, 7.0f);
+const sf::Vector2f ZOMBIE_EXTENT(57.6f, 59.0f);
+const sf::Vector2f POWERUP_EXTENT(25.2f, 22.4f);
+
+#endif // BENCHEXTENTS_HPP
@@ -0,0 +1,98 @@
+#include "BenchHarness.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace {
+    std::atomic<size_t> allocations{ 0 };
+    std::atomic<size_t> bytes{ 0 };
+
+    void* countedAlloc(size_t size) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        bytes.fetch_add(size, std::memory_order_relaxed);
+        if (void* p = std::malloc(size ? size : 1)) return p;
+        throw std::bad_alloc();
+    }
+
+    struct Stats {
+        double min, median, mean, p99, max;
+        double allocations;
+    };
+
+    Stats summarize(const BenchRecorder::Result& result) {
+        std::vector<double> ns;
+        double total = 0.0, totalAllocations = 0.0;
+        for (const auto& sample : result.samples) {
+            ns.push_back(sample.nanoseconds);
+            total += sample.nanoseconds;
+            totalAllocations += static_cast<double>(sample.allocations);
+        }
+        if (ns.empty()) return Stats{ 0, 0, 0, 0, 0, 0 };
+
+        std::sort(ns.begin(), ns.end());
+        double count = static_cast<double>(ns.size());
+        size_t p99 = std::min(ns.size() - 1, static_cast<size_t>(count * 0.99));
+        return Stats{ ns.front(), ns[ns.size() / 2], total / count, ns[p99], ns.back(), totalAllocations / count };
+    }
+}
+
+void* operator new(size_t size) { return countedAlloc(size); }
+void* operator new[](size_t size) { return countedAlloc(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+
+size_t allocationCount() {
+    return allocations.load(std::memory_order_relaxed);
+}
+
+size_t allocatedBytes() {
+    return bytes.load(std::memory_order_relaxed);
+}
+
+void BenchRecorder::writeJson(std::ostream& out) const {
+    out << "{\n  \"results\": [";
+    for (size_t r = 0; r < results.size(); ++r) {
+        const Result& result = results[r];
+        Stats stats = summarize(result);
+        char line[512];
+        std::snprintf(line, sizeof(line),
+            "%s\n    {\"name\": \"%s\", \"entities\": %d, \"obstacles\": %d, \"iterations\": %zu,"
+            " \"ns\": {\"min\": %.0f, \"median\": %.0f, \"mean\": %.0f, \"p99\": %.0f, \"max\": %.0f},"
+            " \"allocationsPerIteration\": %.2f,",
+            r ? "," : "", result.name.c_str(), result.entities, result.obstacles, result.samples.size(),
+            stats.min, stats.median, stats.mean, stats.p99, stats.max, stats.allocations);
+        out << line << "\n     \"samples\": [";
+
+        for (size_t i = 0; i < result.samples.size(); ++i) {
+            const Sample& sample = result.samples[i];
+            std::snprintf(line, sizeof(line), "%s{\"ns\": %.0f, \"allocations\": %zu, \"bytes\": %zu}",
+                i ? ", " : "", sample.nanoseconds, sample.allocations, sample.bytes);
+            out << line;
+        }
+        out << "]}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+void BenchRecorder::writeCsv(std::ostream& out) const {
+    out << "name,entities,obstacles,iteration,ns,allocations,bytes\n";
+    for (const auto& result : results) {
+        for (size_t i = 0; i < result.samples.size(); ++i) {
+            const Sample& sample = result.samples[i];
+            char line[256];
+            std::snprintf(line, sizeof(line), "%s,%d,%d,%zu,%.0f,%zu,%zu\n", result.name.c_str(),
+                result.entities, result.obstacles, i, sample.nanoseconds, sample.allocations, sample.bytes);
+            out << line;
+        }
+    }
+}
+
+void BenchRecorder::printSummary(const Result& result) {
+    Stats stats = summarize(result);
+    std::fprintf(stderr, "%-16s %8d entities %6d obstacles  median %12.3f us  p99 %12.3f us  %8.2f allocs/iter\n",
+        result.name.c_str(), result.entities, result.obstacles, stats.median / 1000.0, stats.p99 / 1000.0, stats.allocations);
+}
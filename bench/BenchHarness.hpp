@@ -0,0 +1,61 @@
+#ifndef BENCHHARNESS_HPP
+#define BENCHHARNESS_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Process-wide counters bumped by the replaced global operator new in BenchHarness.cpp
+size_t allocationCount();
+size_t allocatedBytes();
+
+// Collects one sample per iteration for every (case, entity count, obstacle count) and
+// writes them out as JSON or CSV for regression tracking.
+class BenchRecorder {
+public:
+    struct Sample {
+        double nanoseconds;
+        size_t allocations;
+        size_t bytes;
+    };
+
+    struct Result {
+        std::string name;
+        int entities;
+        int obstacles;
+        std::vector<Sample> samples;
+    };
+
+    // 'setup' runs untimed before every iteration to restore the input state; only 'body'
+    // is timed and only its allocations are counted
+    template <typename Setup, typename Body>
+    void run(const std::string& name, int entities, int obstacles, int iterations, Setup&& setup, Body&& body) {
+        Result result{ name, entities, obstacles, {} };
+        result.samples.reserve(iterations);
+        for (int i = 0; i < iterations; ++i) {
+            setup();
+            size_t allocationsBefore = allocationCount();
+            size_t bytesBefore = allocatedBytes();
+            auto start = std::chrono::steady_clock::now();
+            body();
+            auto end = std::chrono::steady_clock::now();
+            result.samples.push_back({ std::chrono::duration<double, std::nano>(end - start).count(),
+                allocationCount() - allocationsBefore, allocatedBytes() - bytesBefore });
+        }
+        results.push_back(std::move(result));
+        printSummary(results.back());
+    }
+
+    void writeJson(std::ostream& out) const;
+    void writeCsv(std::ostream& out) const;
+
+private:
+    std::vector<Result> results;
+
+    // One human-readable line per result on stderr, so stdout stays machine-readable
+    static void printSummary(const Result& result);
+};
+
+#endif // BENCHHARNESS_HPP
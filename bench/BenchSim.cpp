@@ -0,0 +1,143 @@
+#include "BenchExtents.hpp"
+#include "Simulation.hpp"
+#include "ScriptedInput.hpp"
+#include "ReplayInput.hpp"
+#include "Constants.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Runs the game simulation with no window: a scripted player in the default level,
+// fixed tick length, one seed. Prints throughput, tick-time percentiles and entity counts.
+// A world size above the default streams a generated world in chunks around the player.
+// With --replay it runs a recording made by the game (red-alert --record) instead, tick for
+// tick, and checks that it ends in the recorded state.
+//
+//   bench_sim [ticks] [seed] [zombie spawn interval in seconds] [world size] [obstacles per chunk]
+//   bench_sim --replay <file>
+
+// Same two pillars (cloud.png, 150x62) the game places
+static std::vector<sf::FloatRect> defaultLevel() {
+    return { sf::FloatRect(1000, 800, 150, 62), sf::FloatRect(300, 1200, 150, 62) };
+}
+
+// Sizes of the obstacle images the game generates from: pillar, block, vase, water
+static std::vector<sf::Vector2f> obstacleKinds() {
+    return { sf::Vector2f(150, 62), sf::Vector2f(100, 100), sf::Vector2f(100, 100), sf::Vector2f(150, 150) };
+}
+
+int main(int argc, char* argv[]) {
+    InputRecording recording;
+    std::unique_ptr<ReplayInput> replay;
+    if (argc > 2 && std::strcmp(argv[1], "--replay") == 0) {
+        if (!recording.load(argv[2]) || recording.ticks.empty()) return 1;
+        replay.reset(new ReplayInput(recording));
+    }
+
+    int ticks = argc > 1 ? std::atoi(argv[1]) : static_cast<int>(SIM_TICK_RATE * 600);
+    unsigned int seed = argc > 2 ? static_cast<unsigned int>(std::strtoul(argv[2], nullptr, 10)) : 1u;
+    float spawnInterval = argc > 3 ? static_cast<float>(std::atof(argv[3])) : 3.0f;
+    float worldSize = argc > 4 ? static_cast<float>(std::atof(argv[4])) : WORLD_SIZE;
+    if (worldSize <= 0) worldSize = WORLD_SIZE;
+    int obstaclesPerChunk = argc > 5 ? std::atoi(argv[5]) : (worldSize > WORLD_SIZE ? GENERATED_OBSTACLES_PER_CHUNK : 0);
+    float tickRate = SIM_TICK_RATE;
+    if (replay) {
+        ticks = static_cast<int>(recording.ticks.size());
+        seed = recording.seed;
+        spawnInterval = recording.zombieSpawnInterval;
+        tickRate = recording.tickRate;
+        worldSize = recording.worldSize;
+        obstaclesPerChunk = recording.obstaclesPerChunk;
+    }
+    if (ticks <= 0) ticks = 1;
+
+    const float tick = 1.0f / tickRate;
+
+    Simulation sim(seed, worldSize);
+    sim.player.extent = PLAYER_EXTENT;
+    sim.store.bullets.extent = BULLET_EXTENT;
+    sim.store.zombieBullets.extent = BULLET_EXTENT;
+    sim.store.zombies.extent = ZOMBIE_EXTENT;
+    sim.store.powerUps.extent = POWERUP_EXTENT;
+    sim.world.setObstacleKinds(obstacleKinds());
+    sim.world.setGeneratedObstaclesPerChunk(obstaclesPerChunk);
+    sim.setObstacles(defaultLevel());
+    sim.setZombieSpawnInterval(spawnInterval);
+
+    ScriptedInput script(static_cast<int>(SIM_TICK_RATE * 2));
+    InputSource& input = replay ? static_cast<InputSource&>(*replay) : script;
+
+    std::vector<float> tickMicros;
+    tickMicros.reserve(ticks);
+    size_t peakZombies = 0, peakBullets = 0, peakZombieBullets = 0, peakChunks = 0;
+    int restarts = 0, totalKills = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ticks; ++i) {
+        // A replay restarts exactly where the recorded player did
+        if (replay && replay->restartPending()) {
+            totalKills += sim.zombiesKilled;
+            sim.reset();
+            restarts++;
+        }
+
+        auto tickStart = std::chrono::steady_clock::now();
+        sim.step(tick, input.sample());
+        auto tickEnd = std::chrono::steady_clock::now();
+        tickMicros.push_back(std::chrono::duration<float, std::micro>(tickEnd - tickStart).count());
+
+        peakZombies = std::max(peakZombies, sim.store.zombies.size());
+        peakBullets = std::max(peakBullets, sim.store.bullets.size());
+        peakZombieBullets = std::max(peakZombieBullets, sim.store.zombieBullets.size());
+        peakChunks = std::max(peakChunks, sim.world.getLoadedChunkCount());
+
+        // Keep the load going: a dead player restarts the round, as pressing R would
+        if (!replay && sim.isPlayerDead()) {
+            totalKills += sim.zombiesKilled;
+            sim.reset();
+            script.reset();
+            restarts++;
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    totalKills += sim.zombiesKilled;
+
+    std::vector<float> sorted = tickMicros;
+    auto percentile = [&sorted](double p) {
+        size_t index = std::min(sorted.size() - 1, static_cast<size_t>(p * sorted.size()));
+        std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+        return sorted[index];
+    };
+    float p50 = percentile(0.50);
+    float p99 = percentile(0.99);
+    float worst = *std::max_element(tickMicros.begin(), tickMicros.end());
+
+    std::printf("bench_sim: %d ticks at %.0f Hz (%.1f simulated s), seed %u, zombie spawn every %.2f s%s\n",
+        ticks, tickRate, ticks * tick, seed, spawnInterval, replay ? ", replayed" : "");
+    std::printf("  wall time      %10.3f s\n", seconds);
+    std::printf("  ticks/s        %10.0f  (%.1fx real time)\n", ticks / seconds, ticks * tick / seconds);
+    std::printf("  tick p50       %10.2f us\n", p50);
+    std::printf("  tick p99       %10.2f us\n", p99);
+    std::printf("  tick max       %10.2f us\n", worst);
+    std::printf("  zombies        %10zu now, %zu peak\n", sim.store.zombies.size(), peakZombies);
+    std::printf("  bullets        %10zu now, %zu peak\n", sim.store.bullets.size(), peakBullets);
+    std::printf("  zombie bullets %10zu now, %zu peak\n", sim.store.zombieBullets.size(), peakZombieBullets);
+    std::printf("  power-ups      %10zu now\n", sim.store.powerUps.size());
+    std::printf("  chunks loaded  %10zu now, %zu peak (world %.0f, %d obstacles per chunk)\n",
+        sim.world.getLoadedChunkCount(), peakChunks, worldSize, obstaclesPerChunk);
+    std::printf("  kills %d, restarts %d\n", totalKills, restarts);
+    std::printf("  state hash     %016llx\n", static_cast<unsigned long long>(sim.hashState()));
+    if (replay) {
+        bool matches = sim.hashState() == recording.finalStateHash;
+        std::printf("  replay         %s the recording\n", matches ? "matches" : "DIFFERS FROM");
+        if (!matches) return 2;
+    }
+
+    return 0;
+}
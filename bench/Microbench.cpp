@@ -0,0 +1,209 @@
+#include "Microbench.hpp"
+#include "BenchExtents.hpp"
+#include "Simulation.hpp"
+#include "ProjectileSystem.hpp"
+#include "ZombieSystem.hpp"
+#include "Constants.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+
+namespace {
+    const float TICK = 1.0f / SIM_TICK_RATE;
+
+    std::vector<sf::FloatRect> makeObstacles(int count, std::mt19937& rng) {
+        std::uniform_real_distribution<float> coord(0.0f, WORLD_SIZE - 150.0f);
+        std::vector<sf::FloatRect> obstacles;
+        for (int i = 0; i < count; ++i)
+            obstacles.emplace_back(coord(rng), coord(rng), 150.0f, 62.0f);
+        return obstacles;
+    }
+
+    // Like the game, zombies only spawn where they do not overlap an obstacle (when one can be found)
+    void addZombies(ZombieArchetype& zombies, int count, std::mt19937& rng, const StaticCollisionWorld* staticWorld = nullptr) {
+        std::uniform_real_distribution<float> coord(0.0f, WORLD_SIZE);
+        for (int i = 0; i < count; ++i) {
+            sf::Vector2f position(coord(rng), coord(rng));
+            for (int attempt = 0; staticWorld && attempt < 32 && staticWorld->overlaps(sf::FloatRect(position, ZOMBIE_EXTENT)); ++attempt)
+                position = sf::Vector2f(coord(rng), coord(rng));
+            spawnZombie(zombies, position, rng);
+            // Spread fire timers so some zombies shoot on every measured tick
+            zombies.fireTimer.back() = std::uniform_real_distribution<float>(0.0f, zombies.fireInterval.back())(rng);
+        }
+    }
+
+    void addBullets(ProjectilePool& bullets, int count, std::mt19937& rng) {
+        std::uniform_real_distribution<float> coord(0.0f, WORLD_SIZE);
+        std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+        for (int i = 0; i < count; ++i) {
+            float a = angle(rng);
+            bullets.add(sf::Vector2f(coord(rng), coord(rng)), sf::Vector2f(std::cos(a), std::sin(a)) * BULLET_SPEED * 0.6f,
+                PROJECTILE_TTL, TextureId::Bullet);
+        }
+    }
+
+    // Half bullets, half zombies, then one Simulation::checkCollisions pass
+    void benchCollisions(BenchRecorder& recorder, const SuiteOptions& options, int entities, int obstacleCount) {
+        std::mt19937 rng(static_cast<unsigned>(entities * 31 + obstacleCount));
+        Simulation sim(1u);
+        sim.player.extent = PLAYER_EXTENT;
+        sim.setObstacles(makeObstacles(obstacleCount, rng));
+
+        // Bench scenes go well past the game's pool capacities
+        EntityStore scene;
+        scene.bullets = ProjectilePool(entities, ProjectilePool::DropPolicy::DropNewest);
+        scene.zombieBullets = ProjectilePool(entities, ProjectilePool::DropPolicy::DropNewest);
+        scene.bullets.extent = scene.zombieBullets.extent = BULLET_EXTENT;
+        scene.zombies.extent = ZOMBIE_EXTENT;
+        addBullets(scene.bullets, entities / 2, rng);
+        addZombies(scene.zombies, entities - entities / 2, rng);
+        sim.store = scene;
+
+        // Warm-up pass sizes the grid and candidate buffers the way a running game would have
+        sim.checkCollisions();
+
+        recorder.run("collisions", entities, obstacleCount, options.iterations,
+            [&] { sim.store = scene; },
+            [&] { sim.checkCollisions(); });
+    }
+
+    // One updateZombies tick: seek, obstacle slide, and firing
+    void benchZombies(BenchRecorder& recorder, const SuiteOptions& options, int entities, int obstacleCount) {
+        std::mt19937 rng(static_cast<unsigned>(entities * 17 + obstacleCount));
+        std::vector<sf::FloatRect> obstacles = makeObstacles(obstacleCount, rng);
+        StaticCollisionWorld staticWorld;
+        staticWorld.build(obstacles);
+
+        ZombieArchetype scene;
+        scene.extent = ZOMBIE_EXTENT;
+        addZombies(scene, entities, rng, &staticWorld);
+
+        ZombieArchetype zombies;
+        ZombieWorkspace workspace;
+        ProjectilePool zombieBullets(entities, ProjectilePool::DropPolicy::DropNewest);
+        zombieBullets.extent = BULLET_EXTENT;
+        sf::Vector2f playerPosition(WORLD_SIZE / 2, WORLD_SIZE / 2);
+
+        FlowField flowField(sf::FloatRect(0, 0, WORLD_SIZE, WORLD_SIZE), FLOW_FIELD_CELL_SIZE);
+        flowField.setObstacles(obstacles, ZOMBIE_EXTENT);
+        flowField.update(playerPosition);
+
+        recorder.run("zombies", entities, obstacleCount, options.iterations,
+            [&] { zombies = scene; zombieBullets.clear(); },
+            [&] { updateZombies(zombies, TICK, playerPosition, zombieBullets, staticWorld, flowField, workspace); });
+    }
+
+    // Full flow field solve, paid each time the player enters a new cell
+    void benchFlowField(BenchRecorder& recorder, const SuiteOptions& options, int obstacleCount) {
+        std::mt19937 rng(static_cast<unsigned>(obstacleCount));
+        FlowField flowField(sf::FloatRect(0, 0, WORLD_SIZE, WORLD_SIZE), FLOW_FIELD_CELL_SIZE);
+        flowField.setObstacles(makeObstacles(obstacleCount, rng), ZOMBIE_EXTENT);
+
+        int cellCount = flowField.getColumns() * flowField.getRows();
+        bool flip = false;
+        recorder.run("flow_field", cellCount, obstacleCount, options.iterations,
+            [&] { flip = !flip; },
+            [&] { flowField.update(flip ? sf::Vector2f(100, 100) : sf::Vector2f(WORLD_SIZE - 100, WORLD_SIZE - 100)); });
+    }
+
+    // Player::move for 'moves' ticks; cost depends on the obstacle count only
+    void benchPlayerMove(BenchRecorder& recorder, const SuiteOptions& options, int moves, int obstacleCount) {
+        std::mt19937 rng(static_cast<unsigned>(obstacleCount));
+        StaticCollisionWorld staticWorld;
+        staticWorld.build(makeObstacles(obstacleCount, rng));
+
+        Player player;
+        player.extent = PLAYER_EXTENT;
+        sf::FloatRect area(0, 0, WORLD_SIZE, WORLD_SIZE);
+        InputState input;
+        input.right = input.down = input.turnRight = true;
+
+        recorder.run("player_move", moves, obstacleCount, options.iterations,
+            [&] { player.position = sf::Vector2f(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2); },
+            [&] {
+                for (int i = 0; i < moves; ++i)
+                    player.move(TICK, input, staticWorld, area);
+            });
+    }
+
+    // updateProjectiles over a full pool: integrate, age and cull
+    void benchProjectiles(BenchRecorder& recorder, const SuiteOptions& options, int entities) {
+        std::mt19937 rng(static_cast<unsigned>(entities));
+        ProjectilePool scene(entities, ProjectilePool::DropPolicy::DropNewest);
+        scene.extent = BULLET_EXTENT;
+        addBullets(scene, entities, rng);
+
+        ProjectilePool projectiles = scene;
+        sf::FloatRect worldBounds(0, 0, WORLD_SIZE, WORLD_SIZE);
+
+        recorder.run("projectiles", entities, 0, options.iterations,
+            [&] { projectiles = scene; },
+            [&] { updateProjectiles(projectiles, TICK, worldBounds); });
+    }
+
+    std::vector<int> parseList(const char* text) {
+        std::vector<int> values;
+        std::stringstream stream(text);
+        std::string item;
+        while (std::getline(stream, item, ','))
+            if (!item.empty()) values.push_back(std::atoi(item.c_str()));
+        return values;
+    }
+}
+
+void runSimulationBenchmarks(BenchRecorder& recorder, const SuiteOptions& options) {
+    for (int obstacleCount : options.obstacleCounts) {
+        for (int entities : options.entityCounts) {
+            if (options.wants("collisions")) benchCollisions(recorder, options, entities, obstacleCount);
+            if (options.wants("zombies")) benchZombies(recorder, options, entities, obstacleCount);
+        }
+        if (options.wants("player_move")) benchPlayerMove(recorder, options, 1000, obstacleCount);
+        if (options.wants("flow_field")) benchFlowField(recorder, options, obstacleCount);
+    }
+
+    // Projectiles never look at obstacles (those hits are resolved in checkCollisions)
+    for (int entities : options.entityCounts)
+        if (options.wants("projectiles")) benchProjectiles(recorder, options, entities);
+}
+
+int runSuite(int argc, char* argv[]) {
+    SuiteOptions options;
+    for (int i = 0; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--format" && hasValue) options.format = argv[++i];
+        else if (arg == "--out" && hasValue) options.outputPath = argv[++i];
+        else if (arg == "--entities" && hasValue) options.entityCounts = parseList(argv[++i]);
+        else if (arg == "--obstacles" && hasValue) options.obstacleCounts = parseList(argv[++i]);
+        else if (arg == "--iterations" && hasValue) options.iterations = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--filter" && hasValue) options.filter = argv[++i];
+        else if (arg == "--no-render") options.render = false;
+        else {
+            std::cerr << "Error: unknown suite argument " << arg << "!\n";
+            return 1;
+        }
+    }
+
+    BenchRecorder recorder;
+    runSimulationBenchmarks(recorder, options);
+    if (options.render) runRenderBenchmarks(recorder, options);
+
+    std::ofstream file;
+    if (!options.outputPath.empty()) {
+        file.open(options.outputPath);
+        if (!file) {
+            std::cerr << "Error opening " << options.outputPath << "!\n";
+            return 1;
+        }
+    }
+    std::ostream& out = options.outputPath.empty() ? std::cout : file;
+
+    if (options.format == "csv") recorder.writeCsv(out);
+    else recorder.writeJson(out);
+    return 0;
+}
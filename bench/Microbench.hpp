@@ -0,0 +1,30 @@
+#ifndef MICROBENCH_HPP
+#define MICROBENCH_HPP
+
+#include "BenchHarness.hpp"
+#include <string>
+#include <vector>
+
+struct SuiteOptions {
+    std::vector<int> entityCounts{ 10, 100, 1000, 10000, 100000 };
+    std::vector<int> obstacleCounts{ 0, 10, 100, 1000 };
+    int iterations = 20;
+    std::string filter;         // only cases whose name contains this
+    std::string format = "json";
+    std::string outputPath;     // stdout when empty
+    bool render = true;
+
+    bool wants(const char* name) const { return filter.empty() || std::string(name).find(filter) != std::string::npos; }
+};
+
+// Simulation hot paths: collisions, zombie AI, player movement, projectile update
+void runSimulationBenchmarks(BenchRecorder& recorder, const SuiteOptions& options);
+
+// Entity batch and minimap draws into an offscreen sf::RenderTexture (needs a GL context)
+void runRenderBenchmarks(BenchRecorder& recorder, const SuiteOptions& options);
+
+//   suite [--format json|csv] [--out file] [--entities 10,100,...] [--obstacles 0,10,...]
+//         [--iterations n] [--filter name] [--no-render]
+int runSuite(int argc, char* argv[]);
+
+#endif // MICROBENCH_HPP
@@ -0,0 +1,135 @@
+#include "Microbench.hpp"
+#include "Minimap.hpp"
+#include "Obstacle.hpp"
+#include "SpriteBatch.hpp"
+#include "StaticCollisionWorld.hpp"
+#include "EntityStore.hpp"
+#include "ZombieSystem.hpp"
+#include "Constants.hpp"
+#include <SFML/Graphics.hpp>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <random>
+
+namespace {
+    // Flat-colour stand-ins with the asset sizes, so the suite needs no files on disk
+    bool makeTexture(sf::Texture& texture, unsigned int width, unsigned int height, sf::Color color) {
+        sf::Image image;
+        image.create(width, height, color);
+        return texture.loadFromImage(image);
+    }
+
+    std::vector<Obstacle> makeObstacles(const sf::Texture& texture, int count, std::mt19937& rng) {
+        std::uniform_real_distribution<float> coord(0.0f, WORLD_SIZE - 150.0f);
+        std::vector<Obstacle> obstacles;
+        for (int i = 0; i < count; ++i)
+            obstacles.emplace_back(texture, sf::IntRect(0, 0, 150, 62), sf::Vector2f(coord(rng), coord(rng)));
+        return obstacles;
+    }
+}
+
+void runRenderBenchmarks(BenchRecorder& recorder, const SuiteOptions& options) {
+    sf::RenderTexture target;
+    if (!target.create(WINDOW_WIDTH, WINDOW_HEIGHT)) {
+        std::cerr << "Error creating offscreen render target, skipping render benchmarks!\n";
+        return;
+    }
+
+    sf::Texture zombieTexture, obstacleTexture, backgroundTexture;
+    if (!makeTexture(zombieTexture, 288, 295, sf::Color::Green) ||
+        !makeTexture(obstacleTexture, 150, 62, sf::Color::White) ||
+        !makeTexture(backgroundTexture, 1800, 1400, sf::Color(40, 40, 40))) {
+        std::cerr << "Error creating benchmark textures, skipping render benchmarks!\n";
+        return;
+    }
+
+    sf::Sprite zombieSprite(zombieTexture);
+    zombieSprite.setScale(ZOMBIE_SCALE, ZOMBIE_SCALE);
+    sf::Sprite backgroundSprite(backgroundTexture);
+    backgroundSprite.setScale(WORLD_SIZE / 1800.0f, WORLD_SIZE / 1400.0f);
+
+    SpriteBatch spriteBatch;
+    sf::View cameraView(sf::FloatRect(0, 0, WINDOW_WIDTH, WINDOW_HEIGHT));
+
+    for (int obstacleCount : options.obstacleCounts) {
+        std::mt19937 rng(static_cast<unsigned>(obstacleCount));
+        std::vector<Obstacle> obstacles = makeObstacles(obstacleTexture, obstacleCount, rng);
+        std::vector<sf::FloatRect> obstacleBounds;
+        for (const auto& obstacle : obstacles)
+            obstacleBounds.push_back(obstacle.getBounds());
+        StaticCollisionWorld staticWorld;
+        staticWorld.build(obstacleBounds);
+        std::vector<int> visibleObstacles;
+
+        Minimap minimap(MINIMAP_SIZE, WORLD_SIZE, MINIMAP_REFRESH_RATE);
+        minimap.bake(backgroundSprite, obstacles);
+
+        for (int entities : options.entityCounts) {
+            ZombieArchetype zombies;
+            std::uniform_real_distribution<float> coord(0.0f, WORLD_SIZE);
+            for (int i = 0; i < entities; ++i) {
+                spawnZombie(zombies, sf::Vector2f(coord(rng), coord(rng)), rng);
+                zombies.rotation.back() = coord(rng);
+            }
+
+            // Same path as Game::renderEntities: stamp one template sprite per entity into the batch
+            if (options.wants("draw_entities")) {
+                recorder.run("draw_entities", entities, obstacleCount, options.iterations,
+                    [&] { target.clear(sf::Color::Black); },
+                    [&] {
+                        target.setView(cameraView);
+                        spriteBatch.begin();
+                        for (size_t i = 0; i < zombies.size(); ++i) {
+                            zombieSprite.setPosition(zombies.position[i]);
+                            zombieSprite.setRotation(zombies.rotation[i]);
+                            spriteBatch.draw(zombieSprite);
+                        }
+                        for (auto& obstacle : obstacles)
+                            spriteBatch.draw(obstacle.sprite);
+                        spriteBatch.end(target);
+                        target.display();
+                    });
+            }
+
+            // The same scene culled against the camera as Game::renderEntities does, with the
+            // obstacles found through the collision tree; compare with draw_entities
+            if (options.wants("draw_entities_culled")) {
+                sf::FloatRect visible(0, 0, WINDOW_WIDTH, WINDOW_HEIGHT);
+                float reach = std::sqrt(2.0f) * 295 * ZOMBIE_SCALE;
+                recorder.run("draw_entities_culled", entities, obstacleCount, options.iterations,
+                    [&] { target.clear(sf::Color::Black); },
+                    [&] {
+                        target.setView(cameraView);
+                        spriteBatch.begin(visible);
+                        for (size_t i = 0; i < zombies.size(); ++i) {
+                            sf::Vector2f position = zombies.position[i];
+                            if (!spriteBatch.isVisible(sf::FloatRect(position.x - reach, position.y - reach, 2 * reach, 2 * reach))) continue;
+                            zombieSprite.setPosition(position);
+                            zombieSprite.setRotation(zombies.rotation[i]);
+                            spriteBatch.draw(zombieSprite);
+                        }
+                        staticWorld.query(visible, visibleObstacles);
+                        for (int index : visibleObstacles)
+                            spriteBatch.draw(obstacles[index].sprite);
+                        spriteBatch.addCulled(static_cast<unsigned int>(obstacles.size() - visibleObstacles.size()));
+                        spriteBatch.end(target);
+                        target.display();
+                    });
+                std::fprintf(stderr, "%-16s %8u submitted %6u culled\n", "", spriteBatch.getStats().sprites, spriteBatch.getStats().culled);
+            }
+
+            // Forced refresh: the cost paid once every 1 / MINIMAP_REFRESH_RATE seconds in game
+            if (options.wants("draw_minimap")) {
+                recorder.run("draw_minimap", entities, obstacleCount, options.iterations,
+                    [&] { target.clear(sf::Color::Black); },
+                    [&] {
+                        target.setView(target.getDefaultView());
+                        minimap.update(sf::Vector2f(WORLD_SIZE / 2, WORLD_SIZE / 2), zombies, true);
+                        minimap.render(target);
+                        target.display();
+                    });
+            }
+        }
+    }
+}
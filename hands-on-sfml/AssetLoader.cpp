@@ -0,0 +1,126 @@
+#include "AssetLoader.hpp"
+#include "TraceRecorder.hpp"
+#include <iostream>
+
+AssetLoader::AssetLoader(unsigned int workerCount) {
+    workers.reserve(workerCount);
+    for (unsigned int i = 0; i < workerCount; ++i)
+        workers.emplace_back(&AssetLoader::workerLoop, this);
+}
+
+AssetLoader::~AssetLoader() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+        queue.clear();
+    }
+    wake.notify_all();
+    for (auto& worker : workers)
+        worker.join();
+}
+
+void AssetLoader::add(const std::string& name, std::function<bool()> decode, std::function<bool()> upload) {
+    jobs.emplace_back(new Job());
+    Job* job = jobs.back().get();
+    job->name = name;
+    job->traceName = TraceRecorder::get().intern(name);
+    job->decode = std::move(decode);
+    job->upload = std::move(upload);
+
+    if (workers.empty()) {
+        runDecode(*job);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.push_back(job);
+    }
+    wake.notify_one();
+}
+
+void AssetLoader::addTexture(const std::string& path, sf::Texture& texture, bool smooth) {
+    // The decoded pixels live only until the upload has copied them to the GPU
+    std::shared_ptr<sf::Image> image = std::make_shared<sf::Image>();
+    add(path,
+        [image, path] { return image->loadFromFile(path); },
+        [image, &texture, smooth] {
+            bool ok = texture.loadFromImage(*image);
+            texture.setSmooth(smooth);
+            *image = sf::Image();
+            return ok;
+        });
+}
+
+void AssetLoader::runDecode(Job& job) {
+    {
+        TRACE_SCOPE(job.traceName);
+        job.ok = job.decode ? job.decode() : true;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    decodedCount++;
+    ready.push_back(&job);
+    decodedSignal.notify_all();
+}
+
+void AssetLoader::uploadJob(Job& job) {
+    TRACE_SCOPE(job.traceName);
+    if (job.ok && job.upload) job.ok = job.upload();
+    if (!job.ok) {
+        std::cerr << "Error loading " << job.name << "!\n";
+        failed++;
+    }
+    uploaded++;
+}
+
+bool AssetLoader::update(unsigned int maxUploads) {
+    for (unsigned int i = 0; i < maxUploads; ++i) {
+        Job* job = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (ready.empty()) break;
+            job = ready.front();
+            ready.pop_front();
+        }
+        uploadJob(*job);
+    }
+    return isFinished();
+}
+
+void AssetLoader::finish() {
+    while (!isFinished()) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            decodedSignal.wait(lock, [this] { return !ready.empty(); });
+        }
+        update(static_cast<unsigned int>(jobs.size()));
+    }
+}
+
+float AssetLoader::getProgress() const {
+    if (jobs.empty()) return 1.0f;
+
+    // Decoding is most of the work, uploading the rest
+    size_t decoded;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        decoded = decodedCount;
+    }
+    return (decoded * 0.75f + uploaded * 0.25f) / jobs.size();
+}
+
+void AssetLoader::workerLoop() {
+    TRACE_THREAD_NAME("asset loader");
+    for (;;) {
+        Job* job = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this] { return stopping || !queue.empty(); });
+            if (stopping) return;
+            job = queue.front();
+            queue.pop_front();
+        }
+        runDecode(*job);
+    }
+}
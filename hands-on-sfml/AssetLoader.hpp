@@ -0,0 +1,69 @@
+#ifndef ASSETLOADER_HPP
+#define ASSETLOADER_HPP
+
+#include <SFML/Graphics.hpp>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Two-phase asset loading. Each job's decode step (file I/O, image decompression, packing)
+// runs on a worker thread and must not touch OpenGL; its upload step (texture creation and
+// anything else that needs the main thread) runs later from update(). Jobs finish in any
+// order, but uploads only ever happen on the thread that calls update().
+// With zero workers, decoding happens inline in add(), which is the old blocking behaviour.
+class AssetLoader {
+public:
+    explicit AssetLoader(unsigned int workerCount);
+    ~AssetLoader();
+
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    void add(const std::string& name, std::function<bool()> decode, std::function<bool()> upload);
+
+    // Decodes the file into an image off-thread, then uploads it into 'texture'
+    void addTexture(const std::string& path, sf::Texture& texture, bool smooth = false);
+
+    // Runs at most 'maxUploads' pending uploads; returns true once every job has been uploaded
+    bool update(unsigned int maxUploads);
+
+    // Blocks until every job is decoded and uploaded
+    void finish();
+
+    bool isFinished() const { return uploaded == jobs.size(); }
+    float getProgress() const;
+    size_t getFailedCount() const { return failed; }
+
+private:
+    struct Job {
+        std::string name;
+        const char* traceName;   // interned, since trace events outlive the job
+        std::function<bool()> decode;
+        std::function<bool()> upload;
+        bool ok = false;
+    };
+
+    std::vector<std::unique_ptr<Job>> jobs;
+    size_t uploaded = 0;
+    size_t failed = 0;
+
+    std::vector<std::thread> workers;
+    mutable std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable decodedSignal;
+    std::deque<Job*> queue;
+    std::deque<Job*> ready;
+    size_t decodedCount = 0;   // jobs whose decode step has run, guarded by the mutex
+    bool stopping = false;
+
+    void runDecode(Job& job);
+    void uploadJob(Job& job);
+    void workerLoop();
+};
+
+#endif // ASSETLOADER_HPP
@@ -0,0 +1,317 @@
+#include "ChunkWorld.hpp"
+#include "Constants.hpp"
+#include "TraceRecorder.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace {
+    uint64_t splitMix(uint64_t& state) {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    float unitFloat(uint64_t& state) {
+        return static_cast<float>(splitMix(state) >> 40) / static_cast<float>(1ull << 24);
+    }
+
+    const int GENERATION_ATTEMPTS = 8;   // tries per obstacle before giving up on it
+}
+
+ChunkWorld::ChunkWorld(float worldSize, float chunkSize, int activeRadius, unsigned int seed)
+    : worldSize(worldSize), chunkSize(chunkSize),
+    chunksPerSide(std::max(1, static_cast<int>(std::ceil(worldSize / chunkSize)))),
+    activeRadius(std::max(1, activeRadius)),
+    windowChunks(std::min(2 * std::max(1, activeRadius) + 1, chunksPerSide)) {
+    std::shared_ptr<Settings> initial = std::make_shared<Settings>();
+    initial->seed = seed;
+    initial->worldSize = worldSize;
+    initial->chunkSize = chunkSize;
+    settings = initial;
+
+    // A world that fits in the window is generated once and never streams
+    if (isStreaming()) {
+        loader = std::thread(&ChunkWorld::loaderLoop, this);
+    }
+    restart();
+}
+
+ChunkWorld::~ChunkWorld() {
+    if (!loader.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+        requests.clear();
+    }
+    wake.notify_all();
+    loader.join();
+}
+
+uint64_t ChunkWorld::keyOf(int x, int y) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(y)) << 32) | static_cast<uint32_t>(x);
+}
+
+sf::FloatRect ChunkWorld::getActiveArea() const {
+    float size = std::min(windowChunks * chunkSize, worldSize);
+    return sf::FloatRect(0, 0, size, size);
+}
+
+std::shared_ptr<ChunkWorld::Settings> ChunkWorld::editSettings() {
+    // Copy on write: the loader thread may still be generating from the old settings
+    std::shared_ptr<Settings> copy = std::make_shared<Settings>(*settings);
+    settings = copy;
+    return copy;
+}
+
+void ChunkWorld::setPlacedObstacles(const std::vector<sf::FloatRect>& bounds) {
+    editSettings()->placed = bounds;
+}
+
+void ChunkWorld::setObstacleKinds(const std::vector<sf::Vector2f>& sizes) {
+    editSettings()->kinds = sizes;
+}
+
+void ChunkWorld::setGeneratedObstaclesPerChunk(int count) {
+    editSettings()->obstaclesPerChunk = std::max(0, count);
+}
+
+std::unique_ptr<ChunkWorld::Chunk> ChunkWorld::generate(uint64_t key, const Settings& settings) {
+    TRACE_SCOPE("generate_chunk");
+    std::unique_ptr<Chunk> result(new Chunk());
+    if (settings.kinds.empty() || settings.obstaclesPerChunk <= 0) return result;
+
+    int x = static_cast<int>(key & 0xFFFFFFFFu);
+    int y = static_cast<int>(key >> 32);
+    sf::Vector2f corner(x * settings.chunkSize, y * settings.chunkSize);
+    // Chunks on the far edge may be cut short by the world border
+    float width = std::min(settings.chunkSize, settings.worldSize - corner.x);
+    float height = std::min(settings.chunkSize, settings.worldSize - corner.y);
+
+    // The player starts in the first screen of the world, so nothing is generated there
+    sf::FloatRect spawnArea(0, 0, static_cast<float>(WINDOW_WIDTH), static_cast<float>(WINDOW_HEIGHT));
+    uint64_t state = (static_cast<uint64_t>(settings.seed) << 32) ^ key * 0xD6E8FEB86659FD93ull;
+
+    for (int i = 0; i < settings.obstaclesPerChunk; ++i) {
+        int kind = static_cast<int>(splitMix(state) % settings.kinds.size());
+        sf::Vector2f size = settings.kinds[kind];
+        if (size.x > width || size.y > height) continue;
+
+        for (int attempt = 0; attempt < GENERATION_ATTEMPTS; ++attempt) {
+            sf::FloatRect local(unitFloat(state) * (width - size.x), unitFloat(state) * (height - size.y), size.x, size.y);
+            sf::FloatRect global(corner.x + local.left, corner.y + local.top, size.x, size.y);
+
+            bool blocked = global.intersects(spawnArea);
+            for (const auto& placed : settings.placed)
+                blocked = blocked || global.intersects(placed);
+            for (const auto& other : result->obstacles)
+                blocked = blocked || local.intersects(other.bounds);
+
+            if (!blocked) {
+                result->obstacles.push_back(Obstacle{ local, kind });
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+void ChunkWorld::restart() {
+    {
+        // Anything still in flight was generated for the old world
+        std::lock_guard<std::mutex> lock(mutex);
+        generation++;
+        requests.clear();
+        loaded.clear();
+    }
+    chunks.clear();
+    pending.clear();
+    origin = sf::Vector2i(0, 0);
+
+    loadWindow();
+    requestAround();
+    rebuildActive();
+}
+
+sf::Vector2i ChunkWorld::chunkAt(sf::Vector2f local) const {
+    int x = origin.x + static_cast<int>(std::floor(local.x / chunkSize));
+    int y = origin.y + static_cast<int>(std::floor(local.y / chunkSize));
+    return sf::Vector2i(std::max(0, std::min(chunksPerSide - 1, x)), std::max(0, std::min(chunksPerSide - 1, y)));
+}
+
+ChunkWorld::Chunk& ChunkWorld::chunk(int x, int y) {
+    uint64_t key = keyOf(x, y);
+    auto found = chunks.find(key);
+    if (found != chunks.end()) return *found->second;
+
+    // Not prefetched in time: generation is deterministic, so making it here gives the same chunk
+    // the loader would have; its copy is dropped when it arrives
+    std::unique_ptr<Chunk>& slot = chunks[key];
+    slot = generate(key, *settings);
+    return *slot;
+}
+
+void ChunkWorld::integrateLoaded() {
+    std::vector<std::pair<uint64_t, std::unique_ptr<Chunk>>> ready;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ready.swap(loaded);
+    }
+    for (auto& entry : ready) {
+        pending.erase(entry.first);
+        if (chunks.find(entry.first) == chunks.end())
+            chunks[entry.first] = std::move(entry.second);
+    }
+}
+
+void ChunkWorld::loadWindow() {
+    for (int y = origin.y; y < origin.y + windowChunks; ++y)
+        for (int x = origin.x; x < origin.x + windowChunks; ++x)
+            chunk(x, y);
+}
+
+void ChunkWorld::requestAround() {
+    if (!loader.joinable()) return;
+
+    // One ring beyond the window, so the next move finds its chunks already generated
+    bool requested = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (int y = std::max(0, origin.y - 1); y <= std::min(chunksPerSide - 1, origin.y + windowChunks); ++y) {
+            for (int x = std::max(0, origin.x - 1); x <= std::min(chunksPerSide - 1, origin.x + windowChunks); ++x) {
+                uint64_t key = keyOf(x, y);
+                if (chunks.count(key) || pending.count(key)) continue;
+                pending.insert(key);
+                requests.push_back(Request{ key, generation, settings });
+                requested = true;
+            }
+        }
+    }
+    if (requested) wake.notify_one();
+}
+
+void ChunkWorld::unloadFar() {
+    // Two rings of slack, so walking back and forth over a border does not regenerate chunks;
+    // chunks holding parked entities stay until those entities come back
+    for (auto it = chunks.begin(); it != chunks.end();) {
+        int x = static_cast<int>(it->first & 0xFFFFFFFFu);
+        int y = static_cast<int>(it->first >> 32);
+        bool far = x < origin.x - 2 || y < origin.y - 2 || x > origin.x + windowChunks + 1 || y > origin.y + windowChunks + 1;
+        if (far && it->second->zombies.empty() && it->second->powerUps.empty())
+            it = chunks.erase(it);
+        else
+            ++it;
+    }
+}
+
+void ChunkWorld::rebuildActive() {
+    sf::Vector2f originPosition(origin.x * chunkSize, origin.y * chunkSize);
+    activeBounds = sf::FloatRect(0, 0,
+        std::min(windowChunks * chunkSize, worldSize - originPosition.x),
+        std::min(windowChunks * chunkSize, worldSize - originPosition.y));
+    activeObstacles.clear();
+    activeKinds.clear();
+
+    // Placed obstacles first and in their given order, so a world without generated ones is
+    // exactly the hand-made map
+    sf::FloatRect window(originPosition.x, originPosition.y, activeBounds.width, activeBounds.height);
+    for (const auto& placed : settings->placed) {
+        if (!placed.intersects(window)) continue;
+        activeObstacles.push_back(sf::FloatRect(placed.left - originPosition.x, placed.top - originPosition.y, placed.width, placed.height));
+        activeKinds.push_back(0);
+    }
+
+    for (int y = origin.y; y < origin.y + windowChunks; ++y) {
+        for (int x = origin.x; x < origin.x + windowChunks; ++x) {
+            sf::Vector2f corner((x - origin.x) * chunkSize, (y - origin.y) * chunkSize);
+            for (const auto& obstacle : chunk(x, y).obstacles) {
+                activeObstacles.push_back(sf::FloatRect(corner.x + obstacle.bounds.left, corner.y + obstacle.bounds.top,
+                    obstacle.bounds.width, obstacle.bounds.height));
+                activeKinds.push_back(obstacle.kind);
+            }
+        }
+    }
+    version++;
+}
+
+bool ChunkWorld::recentre(sf::Vector2f focus, sf::Vector2f& shift) {
+    integrateLoaded();
+    if (!isStreaming()) return false;
+
+    // Only move once the focus reaches the outer ring, so a player pacing along a chunk border
+    // does not shift the world every other tick
+    sf::Vector2i focusChunk = chunkAt(focus);
+    int centre = windowChunks / 2;
+    int dx = focusChunk.x - (origin.x + centre);
+    int dy = focusChunk.y - (origin.y + centre);
+    if (std::abs(dx) < activeRadius && std::abs(dy) < activeRadius) return false;
+
+    sf::Vector2i target(std::max(0, std::min(chunksPerSide - windowChunks, focusChunk.x - centre)),
+        std::max(0, std::min(chunksPerSide - windowChunks, focusChunk.y - centre)));
+    if (target == origin) return false;
+
+    TRACE_SCOPE("recentre_world");
+    shift = sf::Vector2f((origin.x - target.x) * chunkSize, (origin.y - target.y) * chunkSize);
+    origin = target;
+
+    loadWindow();
+    requestAround();
+    unloadFar();
+    rebuildActive();
+    return true;
+}
+
+void ChunkWorld::parkZombie(const DormantZombie& zombie) {
+    sf::Vector2i at = chunkAt(zombie.position);
+    DormantZombie parked = zombie;
+    parked.position -= sf::Vector2f((at.x - origin.x) * chunkSize, (at.y - origin.y) * chunkSize);
+    chunk(at.x, at.y).zombies.push_back(parked);
+}
+
+void ChunkWorld::parkPowerUp(const DormantPowerUp& powerUp) {
+    sf::Vector2i at = chunkAt(powerUp.position);
+    DormantPowerUp parked = powerUp;
+    parked.position -= sf::Vector2f((at.x - origin.x) * chunkSize, (at.y - origin.y) * chunkSize);
+    chunk(at.x, at.y).powerUps.push_back(parked);
+}
+
+void ChunkWorld::takeActiveDormant(std::vector<DormantZombie>& zombies, std::vector<DormantPowerUp>& powerUps) {
+    // Row-major and in parking order, so the entities come back in the same order every run
+    for (int y = origin.y; y < origin.y + windowChunks; ++y) {
+        for (int x = origin.x; x < origin.x + windowChunks; ++x) {
+            Chunk& active = chunk(x, y);
+            sf::Vector2f corner((x - origin.x) * chunkSize, (y - origin.y) * chunkSize);
+            for (DormantZombie zombie : active.zombies) {
+                zombie.position += corner;
+                zombies.push_back(zombie);
+            }
+            for (DormantPowerUp powerUp : active.powerUps) {
+                powerUp.position += corner;
+                powerUps.push_back(powerUp);
+            }
+            active.zombies.clear();
+            active.powerUps.clear();
+        }
+    }
+}
+
+void ChunkWorld::loaderLoop() {
+    TRACE_THREAD_NAME("chunk loader");
+    for (;;) {
+        Request request;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this] { return stopping || !requests.empty(); });
+            if (stopping) return;
+            request = requests.front();
+            requests.pop_front();
+        }
+
+        std::unique_ptr<Chunk> result = generate(request.key, *request.settings);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (request.generation == generation)
+            loaded.emplace_back(request.key, std::move(result));
+    }
+}
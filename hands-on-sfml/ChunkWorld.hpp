@@ -0,0 +1,146 @@
+#ifndef CHUNKWORLD_HPP
+#define CHUNKWORLD_HPP
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+#include "PowerUp.hpp"
+
+// A square world cut into square chunks. The simulation only sees a window of chunks around
+// the player (the active area), in local coordinates whose origin is the window's top-left
+// corner, so positions stay small however large the world is. When the player enters another
+// chunk the window slides and everything local shifts by whole chunks. Chunks near the
+// window are generated on a background thread; obstacles are a pure function of the seed and
+// the chunk, so streaming order never changes a run. Entities that drop out of the window
+// are parked in their chunk, stored relative to its corner, until it becomes active again.
+class ChunkWorld {
+public:
+    struct DormantZombie {
+        sf::Vector2f position;
+        float rotation;
+        int health;
+        float fireTimer;
+        float fireInterval;
+        uint32_t randomState;
+    };
+
+    struct DormantPowerUp {
+        sf::Vector2f position;
+        PowerUp::Type type;
+    };
+
+    ChunkWorld(float worldSize, float chunkSize, int activeRadius, unsigned int seed);
+    ~ChunkWorld();
+
+    ChunkWorld(const ChunkWorld&) = delete;
+    ChunkWorld& operator=(const ChunkWorld&) = delete;
+
+    // Settings, in world coordinates; they take effect at the next restart()
+    void setPlacedObstacles(const std::vector<sf::FloatRect>& bounds);
+    void setObstacleKinds(const std::vector<sf::Vector2f>& sizes);
+    void setGeneratedObstaclesPerChunk(int count);
+
+    // Drops every chunk and parked entity and puts the window back at the world's corner
+    void restart();
+
+    // Slides the window so the chunk under 'focus' (local) is in its middle, as far as the world
+    // edges allow. Returns true if it moved; 'shift' must then be added to every local position.
+    bool recentre(sf::Vector2f focus, sf::Vector2f& shift);
+
+    void parkZombie(const DormantZombie& zombie);
+    void parkPowerUp(const DormantPowerUp& powerUp);
+    // Moves everything parked in the active chunks out, in local coordinates
+    void takeActiveDormant(std::vector<DormantZombie>& zombies, std::vector<DormantPowerUp>& powerUps);
+
+    // Largest area the window can cover, for sizing grids once
+    sf::FloatRect getActiveArea() const;
+    // The window clipped to the world edge, in local coordinates
+    const sf::FloatRect& getActiveBounds() const { return activeBounds; }
+    const std::vector<sf::FloatRect>& getActiveObstacles() const { return activeObstacles; }
+    const std::vector<int>& getActiveObstacleKinds() const { return activeKinds; }
+
+    // Position of the local origin in the world is origin * chunk size
+    sf::Vector2i getOrigin() const { return origin; }
+    float getChunkSize() const { return chunkSize; }
+    float getWorldSize() const { return worldSize; }
+    // False when the window already covers the whole world and never moves
+    bool isStreaming() const { return windowChunks < chunksPerSide; }
+    int getGeneratedObstaclesPerChunk() const { return settings->obstaclesPerChunk; }
+    size_t getLoadedChunkCount() const { return chunks.size(); }
+    // Bumped whenever the active obstacles change, so renderers know to rebuild
+    unsigned int getVersion() const { return version; }
+
+private:
+    struct Obstacle {
+        sf::FloatRect bounds;   // relative to the chunk corner
+        int kind;
+    };
+
+    struct Chunk {
+        std::vector<Obstacle> obstacles;
+        std::vector<DormantZombie> zombies;
+        std::vector<DormantPowerUp> powerUps;
+    };
+
+    // Everything generation reads; replaced, never modified, so loads in flight keep a consistent copy
+    struct Settings {
+        unsigned int seed;
+        float worldSize;
+        float chunkSize;
+        std::vector<sf::FloatRect> placed;
+        std::vector<sf::Vector2f> kinds;
+        int obstaclesPerChunk = 0;
+    };
+
+    struct Request {
+        uint64_t key;
+        unsigned int generation;
+        std::shared_ptr<const Settings> settings;
+    };
+
+    float worldSize;
+    float chunkSize;
+    int chunksPerSide;
+    int activeRadius;
+    int windowChunks;
+    sf::Vector2i origin;
+    sf::FloatRect activeBounds;
+    std::vector<sf::FloatRect> activeObstacles;
+    std::vector<int> activeKinds;
+    unsigned int version = 0;
+
+    std::shared_ptr<const Settings> settings;
+    std::map<uint64_t, std::unique_ptr<Chunk>> chunks;   // simulating thread only
+    std::set<uint64_t> pending;
+
+    std::thread loader;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::deque<Request> requests;
+    std::vector<std::pair<uint64_t, std::unique_ptr<Chunk>>> loaded;
+    unsigned int generation = 0;
+    bool stopping = false;
+
+    static uint64_t keyOf(int x, int y);
+    static std::unique_ptr<Chunk> generate(uint64_t key, const Settings& settings);
+
+    std::shared_ptr<Settings> editSettings();
+    sf::Vector2i chunkAt(sf::Vector2f local) const;
+    Chunk& chunk(int x, int y);
+    void integrateLoaded();
+    void loadWindow();
+    void requestAround();
+    void unloadFar();
+    void rebuildActive();
+    void loaderLoop();
+};
+
+#endif // CHUNKWORLD_HPP
@@ -1,17 +1,64 @@
 #ifndef CONSTANTS_HPP
 #define CONSTANTS_HPP
 
+#include <cstddef>
+
 constexpr int WINDOW_WIDTH = 1200;
 constexpr int WINDOW_HEIGHT = 900;
-constexpr float PLAYER_SPEED = 0.125f;
-constexpr float BULLET_SPEED = 0.5f;
-constexpr float ZOMBIE_SPEED = 0.005f;
+constexpr float WORLD_SIZE = 2000.0f;          // default world, the original hand-made map
+constexpr float CHUNK_SIZE = 512.0f;
+constexpr int ACTIVE_CHUNK_RADIUS = 2;         // chunks simulated on each side of the player's
+constexpr int GENERATED_OBSTACLES_PER_CHUNK = 2; // used for worlds larger than WORLD_SIZE
+constexpr float BACKGROUND_TILE_SIZE = 2000.0f; // world units covered by one copy of the background
+constexpr float COLLISION_CELL_SIZE = 64.0f;
+constexpr float FLOW_FIELD_CELL_SIZE = 32.0f;
+constexpr float SIM_TICK_RATE = 120.0f;      // simulation ticks per second
+constexpr float MAX_FRAME_TIME = 0.25f;      // longest frame fed to the accumulator, in seconds
+constexpr int FAST_REPLAY_TICKS_PER_FRAME = 64; // ticks simulated per rendered frame when replaying flat out
+constexpr bool THREADED_SIMULATION = true;   // false ticks on the main thread between frames, as before
+constexpr unsigned int FRAME_RATE_LIMIT = 144;
+constexpr unsigned int UNFOCUSED_FRAME_RATE = 15; // while another window has focus
+constexpr int FRAME_SPIN_MARGIN_MS = 2;      // frame pacing spins instead of sleeping for the last stretch
+constexpr int IDLE_WAKE_INTERVAL_MS = 250;   // static screens redraw at least this often
+constexpr int IDLE_POLL_INTERVAL_MS = 2;     // event polling period while a static screen waits
+constexpr float FRAME_BUDGET_MS = 1000.0f / 60; // frame time the profiler measures against
+constexpr float PLAYER_SPEED = 250.0f;       // units per second
+constexpr float PLAYER_ROTATION_SPEED = 100.0f; // degrees per second
+constexpr float BULLET_SPEED = 1000.0f;      // units per second
+constexpr float PLAYER_FIRE_INTERVAL = 1.0f / 30; // seconds between shots while fire is held
+constexpr float ZOMBIE_SPEED = 10.0f;        // units per second
+constexpr float BULLET_SCALE = 0.1f;
+constexpr float ZOMBIE_SCALE = 0.2f;
+constexpr float POWERUP_SCALE = 0.2f;
+constexpr float PROJECTILE_TTL = 8.0f;       // seconds before a bullet expires on its own
+constexpr size_t PLAYER_BULLET_CAPACITY = 2048;
+constexpr size_t ZOMBIE_BULLET_CAPACITY = 4096;
+constexpr bool USE_ATLAS_CACHE = true;
+constexpr const char* ATLAS_CACHE_PREFIX = "assets/atlas_cache";
+constexpr bool ASYNC_ASSET_LOADING = true;   // false loads everything in the constructor, as before
+constexpr unsigned int ASSET_LOADER_THREADS = 4;
+constexpr unsigned int ASSET_UPLOADS_PER_FRAME = 2;
+constexpr unsigned int MINIMAP_SIZE = 200;
+constexpr float MINIMAP_REFRESH_RATE = 10.0f; // minimap redraws per second
+constexpr const char* HIGH_SCORE_PATH = "highscore.txt";
+constexpr int PROFILER_HISTORY = 300;       // frames kept by the profiler's ring buffer
+constexpr int PROFILER_MAX_SCOPES = 32;
+constexpr const char* PROFILER_DUMP_PREFIX = "profile"; // writes profile.csv and profile.json
+constexpr float TRACE_SPIKE_BUDGET_MS = 2 * 1000.0f / 60; // frames longer than this are written out as a trace
+constexpr float TRACE_WINDOW_BEFORE_MS = 1000.0f;
+constexpr int TRACE_FRAMES_AFTER_SPIKE = 30;
+constexpr int TRACE_MAX_DUMPS = 10;
+constexpr size_t TRACE_EVENTS_PER_THREAD = 16384;
+constexpr const char* TRACE_DUMP_PREFIX = "trace";       // writes trace_<n>.json
 constexpr int MAX_ZOMBIES = 5;
 constexpr float MIN_SPAWN_DISTANCE = 200.0f;
 constexpr float ZOMBIE_FIRE_MIN_INTERVAL = 1.0f;
 constexpr float ZOMBIE_FIRE_MAX_INTERVAL = 3.0f;
+constexpr size_t ZOMBIE_UPDATE_CHUNK = 256;  // zombies per parallel task
 constexpr int ZOMBIE_HEALTH = 3;
 constexpr int PLAYER_MAX_HEALTH = 20;
-enum class GameState { MENU, PLAYING, GAME_OVER };
+constexpr float BOOST_DURATION = 5.0f;
+constexpr float POWERUP_SPAWN_INTERVAL = 10.0f;
+enum class GameState { LOADING, MENU, PLAYING, GAME_OVER };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,59 @@
+#include "CpuFeatures.hpp"
+#include <algorithm>
+
+#if SIMD_X86 && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace {
+    SimdLevel queryCpu() {
+#if SIMD_X86 && defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        int maxLeaf = info[0];
+        __cpuid(info, 1);
+        bool sse2 = (info[3] & (1 << 26)) != 0;
+        bool osSavesAvx = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 &&
+            (_xgetbv(0) & 6) == 6;   // XMM and YMM state enabled by the OS
+        bool avx2 = false;
+        if (maxLeaf >= 7 && osSavesAvx) {
+            __cpuidex(info, 7, 0);
+            avx2 = (info[1] & (1 << 5)) != 0;
+        }
+        if (avx2) return SimdLevel::AVX2;
+        if (sse2) return SimdLevel::SSE2;
+#elif SIMD_X86 && defined(__GNUC__)
+        // Also checks that the OS saves the YMM registers
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+        if (__builtin_cpu_supports("sse2")) return SimdLevel::SSE2;
+#endif
+        return SimdLevel::Scalar;
+    }
+
+    SimdLevel& activeLevel() {
+        static SimdLevel level = detectSimdLevel();
+        return level;
+    }
+}
+
+SimdLevel detectSimdLevel() {
+    static const SimdLevel detected = queryCpu();
+    return detected;
+}
+
+SimdLevel getSimdLevel() {
+    return activeLevel();
+}
+
+void setSimdLevel(SimdLevel level) {
+    activeLevel() = std::min(level, detectSimdLevel());
+}
+
+const char* getSimdLevelName(SimdLevel level) {
+    switch (level) {
+    case SimdLevel::SSE2: return "SSE2";
+    case SimdLevel::AVX2: return "AVX2";
+    default: return "scalar";
+    }
+}
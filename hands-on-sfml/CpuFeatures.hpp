@@ -0,0 +1,36 @@
+#ifndef CPUFEATURES_HPP
+#define CPUFEATURES_HPP
+
+// Instruction sets the vectorized kernels can use, in increasing order. Every kernel gives
+// bit-identical results at every level (no fused multiply-add), so a recording replays the
+// same on any CPU.
+enum class SimdLevel {
+    Scalar,
+    SSE2,
+    AVX2
+};
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define SIMD_X86 1
+#else
+#define SIMD_X86 0
+#endif
+
+// GCC and Clang only emit AVX2 inside functions marked for it; MSVC accepts the intrinsics anywhere
+#if SIMD_X86 && defined(__GNUC__)
+#define SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define SIMD_TARGET_AVX2
+#endif
+
+// Best level this CPU and OS support, detected on first use
+SimdLevel detectSimdLevel();
+
+// Level the kernels dispatch on: the detected one unless lowered, e.g. by a benchmark
+// comparing paths. Set it before any simulation thread starts.
+SimdLevel getSimdLevel();
+void setSimdLevel(SimdLevel level);
+
+const char* getSimdLevelName(SimdLevel level);
+
+#endif // CPUFEATURES_HPP
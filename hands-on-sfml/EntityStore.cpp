@@ -0,0 +1,111 @@
+#include "EntityStore.hpp"
+
+void ZombieArchetype::add(sf::Vector2f spawnPosition, float firstFireInterval, uint32_t randomSeed) {
+    position.push_back(spawnPosition);
+    previousPosition.push_back(spawnPosition);
+    rotation.push_back(0.0f);
+    previousRotation.push_back(0.0f);
+    health.push_back(ZOMBIE_HEALTH);
+    fireTimer.push_back(0.0f);
+    fireInterval.push_back(firstFireInterval);
+    randomState.push_back(randomSeed);
+    texture.push_back(TextureId::Zombie);
+}
+
+void ZombieArchetype::removeDead() {
+    // Single stable compaction pass, so zombie order (and first-hit order) is preserved
+    size_t alive = 0;
+    for (size_t i = 0; i < size(); ++i) {
+        if (health[i] <= 0) continue;
+        if (alive != i) {
+            position[alive] = position[i];
+            previousPosition[alive] = previousPosition[i];
+            rotation[alive] = rotation[i];
+            previousRotation[alive] = previousRotation[i];
+            health[alive] = health[i];
+            fireTimer[alive] = fireTimer[i];
+            fireInterval[alive] = fireInterval[i];
+            randomState[alive] = randomState[i];
+            texture[alive] = texture[i];
+        }
+        alive++;
+    }
+
+    position.resize(alive);
+    previousPosition.resize(alive);
+    rotation.resize(alive);
+    previousRotation.resize(alive);
+    health.resize(alive);
+    fireTimer.resize(alive);
+    fireInterval.resize(alive);
+    randomState.resize(alive);
+    texture.resize(alive);
+}
+
+void ZombieArchetype::clear() {
+    position.clear();
+    previousPosition.clear();
+    rotation.clear();
+    previousRotation.clear();
+    health.clear();
+    fireTimer.clear();
+    fireInterval.clear();
+    randomState.clear();
+    texture.clear();
+}
+
+sf::FloatRect ZombieArchetype::bounds(size_t index) const {
+    return sf::FloatRect(position[index], extent);
+}
+
+void PowerUpArchetype::add(sf::Vector2f spawnPosition, PowerUp::Type powerUpType) {
+    static const TextureId textures[] = { TextureId::PowerUpHealth, TextureId::PowerUpSpeed, TextureId::PowerUpDamage };
+
+    position.push_back(spawnPosition);
+    type.push_back(powerUpType);
+    texture.push_back(textures[powerUpType]);
+}
+
+void PowerUpArchetype::remove(size_t index) {
+    // Swap-remove: nothing depends on power-up order
+    size_t last = size() - 1;
+    if (index != last) {
+        position[index] = position[last];
+        type[index] = type[last];
+        texture[index] = texture[last];
+    }
+
+    position.pop_back();
+    type.pop_back();
+    texture.pop_back();
+}
+
+void PowerUpArchetype::clear() {
+    position.clear();
+    type.clear();
+    texture.clear();
+}
+
+sf::FloatRect PowerUpArchetype::bounds(size_t index) const {
+    return sf::FloatRect(position[index], extent);
+}
+
+EntityStore::EntityStore()
+    : bullets(PLAYER_BULLET_CAPACITY, ProjectilePool::DropPolicy::DropOldest),
+      zombieBullets(ZOMBIE_BULLET_CAPACITY, ProjectilePool::DropPolicy::DropNewest) {
+}
+
+void EntityStore::clear() {
+    bullets.clear();
+    zombieBullets.clear();
+    zombies.clear();
+    powerUps.clear();
+}
+
+void EntityStore::storePreviousState() {
+    // Plain array copies; capacity is retained so this does not allocate in steady state
+    bullets.previousPosition = bullets.position;
+    zombieBullets.previousPosition = zombieBullets.position;
+    zombies.previousPosition = zombies.position;
+    zombies.previousRotation = zombies.rotation;
+}
@@ -0,0 +1,60 @@
+#ifndef ENTITYSTORE_HPP
+#define ENTITYSTORE_HPP
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+#include <vector>
+#include "Constants.hpp"
+#include "PowerUp.hpp"
+#include "ProjectilePool.hpp"
+#include "TextureId.hpp"
+
+// Each archetype keeps one contiguous array per component, all indexed by entity slot.
+// 'extent' is the collision box size shared by every entity of the archetype.
+
+struct ZombieArchetype {
+    std::vector<sf::Vector2f> position;
+    std::vector<sf::Vector2f> previousPosition;
+    std::vector<float> rotation;
+    std::vector<float> previousRotation;
+    std::vector<int> health;
+    std::vector<float> fireTimer;
+    std::vector<float> fireInterval;
+    std::vector<uint32_t> randomState;   // per-zombie stream, so update order never changes the rolls
+    std::vector<TextureId> texture;
+    sf::Vector2f extent;
+
+    size_t size() const { return position.size(); }
+    void add(sf::Vector2f spawnPosition, float firstFireInterval, uint32_t randomSeed);
+    void removeDead();
+    void clear();
+    sf::FloatRect bounds(size_t index) const;
+};
+
+struct PowerUpArchetype {
+    std::vector<sf::Vector2f> position;
+    std::vector<PowerUp::Type> type;
+    std::vector<TextureId> texture;
+    sf::Vector2f extent;
+
+    size_t size() const { return position.size(); }
+    void add(sf::Vector2f spawnPosition, PowerUp::Type powerUpType);
+    void remove(size_t index);
+    void clear();
+    sf::FloatRect bounds(size_t index) const;
+};
+
+struct EntityStore {
+    ProjectilePool bullets;
+    ProjectilePool zombieBullets;
+    ZombieArchetype zombies;
+    PowerUpArchetype powerUps;
+
+    EntityStore();
+
+    void clear();
+    void storePreviousState();
+};
+
+#endif // ENTITYSTORE_HPP
@@ -0,0 +1,150 @@
+#include "FlowField.hpp"
+#include "Profiler.hpp"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+namespace {
+    constexpr uint32_t UNREACHED = std::numeric_limits<uint32_t>::max();
+    constexpr uint32_t STRAIGHT_COST = 10;
+    constexpr uint32_t DIAGONAL_COST = 14;
+
+    const int NEIGHBOUR_X[8] = { 1, -1, 0, 0, 1, 1, -1, -1 };
+    const int NEIGHBOUR_Y[8] = { 0, 0, 1, -1, 1, -1, 1, -1 };
+
+    uint32_t octileDistance(int dx, int dy) {
+        dx = std::abs(dx);
+        dy = std::abs(dy);
+        return STRAIGHT_COST * static_cast<uint32_t>(std::max(dx, dy) - std::min(dx, dy)) +
+            DIAGONAL_COST * static_cast<uint32_t>(std::min(dx, dy));
+    }
+}
+
+FlowField::FlowField(const sf::FloatRect& worldBounds, float cellSize)
+    : worldBounds(worldBounds), cellSize(cellSize), inverseCellSize(1.0f / cellSize),
+    columns(std::max(1, static_cast<int>(std::ceil(worldBounds.width / cellSize)))),
+    rows(std::max(1, static_cast<int>(std::ceil(worldBounds.height / cellSize)))) {
+    size_t cellCount = static_cast<size_t>(columns) * rows;
+    blocked.assign(cellCount, 0);
+    cost.assign(cellCount, UNREACHED);
+    direction.assign(cellCount, sf::Vector2f());
+    open.reserve(cellCount);
+}
+
+int FlowField::cellAt(sf::Vector2f position) const {
+    // Truncation rounds small negatives toward zero, which the clamp maps to the edge cell anyway
+    int x = static_cast<int>((position.x - worldBounds.left) * inverseCellSize);
+    int y = static_cast<int>((position.y - worldBounds.top) * inverseCellSize);
+    x = std::max(0, std::min(columns - 1, x));
+    y = std::max(0, std::min(rows - 1, y));
+    return y * columns + x;
+}
+
+void FlowField::setObstacles(const std::vector<sf::FloatRect>& obstacles, sf::Vector2f agentExtent) {
+    std::fill(blocked.begin(), blocked.end(), 0);
+
+    for (const auto& obstacle : obstacles) {
+        // Every top-left corner in this range puts the agent's box inside the obstacle
+        float left = obstacle.left - agentExtent.x - worldBounds.left;
+        float top = obstacle.top - agentExtent.y - worldBounds.top;
+        float right = obstacle.left + obstacle.width - worldBounds.left;
+        float bottom = obstacle.top + obstacle.height - worldBounds.top;
+
+        int firstX = std::max(0, static_cast<int>(std::floor(left / cellSize)));
+        int firstY = std::max(0, static_cast<int>(std::floor(top / cellSize)));
+        int lastX = std::min(columns - 1, static_cast<int>(std::ceil(right / cellSize)) - 1);
+        int lastY = std::min(rows - 1, static_cast<int>(std::ceil(bottom / cellSize)) - 1);
+
+        for (int y = firstY; y <= lastY; ++y)
+            for (int x = firstX; x <= lastX; ++x)
+                blocked[y * columns + x] = 1;
+    }
+
+    // Force a rebuild against the new occupancy on the next update()
+    targetCell = -1;
+}
+
+bool FlowField::update(sf::Vector2f target) {
+    int cell = cellAt(target);
+    if (cell == targetCell) return false;
+
+    targetCell = cell;
+    rebuild();
+    return true;
+}
+
+void FlowField::rebuild() {
+    PROFILE_SCOPE("flow_field");
+    std::fill(cost.begin(), cost.end(), UNREACHED);
+    std::fill(direction.begin(), direction.end(), sf::Vector2f());
+
+    auto walkable = [this](int x, int y) {
+        return x >= 0 && y >= 0 && x < columns && y < rows && !blocked[y * columns + x];
+    };
+
+    // Dijkstra from the target. The target cell is seeded even when blocked, so a player
+    // hugging a wall still pulls zombies toward the free cells around it.
+    auto later = std::greater<std::pair<uint32_t, int>>();
+    open.clear();
+    cost[targetCell] = 0;
+    open.emplace_back(0, targetCell);
+
+    while (!open.empty()) {
+        std::pop_heap(open.begin(), open.end(), later);
+        std::pair<uint32_t, int> current = open.back();
+        open.pop_back();
+        if (current.first != cost[current.second]) continue;   // stale entry
+
+        int cx = current.second % columns, cy = current.second / columns;
+        for (int n = 0; n < 8; ++n) {
+            int nx = cx + NEIGHBOUR_X[n], ny = cy + NEIGHBOUR_Y[n];
+            if (!walkable(nx, ny)) continue;
+            bool diagonal = n >= 4;
+            if (diagonal && (!walkable(cx + NEIGHBOUR_X[n], cy) || !walkable(cx, cy + NEIGHBOUR_Y[n]))) continue;
+
+            uint32_t next = current.first + (diagonal ? DIAGONAL_COST : STRAIGHT_COST);
+            int neighbour = ny * columns + nx;
+            if (next < cost[neighbour]) {
+                cost[neighbour] = next;
+                open.emplace_back(next, neighbour);
+                std::push_heap(open.begin(), open.end(), later);
+            }
+        }
+    }
+
+    // Only cells whose best path bends around something get a direction; the rest seek straight
+    const float diagonalStep = 0.70710678f;
+    int tx = targetCell % columns, ty = targetCell / columns;
+    for (int y = 0; y < rows; ++y) {
+        for (int x = 0; x < columns; ++x) {
+            int cell = y * columns + x;
+            if (cost[cell] == UNREACHED || cost[cell] == octileDistance(x - tx, y - ty)) continue;
+
+            uint32_t best = cost[cell];
+            for (int n = 0; n < 8; ++n) {
+                int nx = x + NEIGHBOUR_X[n], ny = y + NEIGHBOUR_Y[n];
+                if (nx < 0 || ny < 0 || nx >= columns || ny >= rows) continue;
+                if (!walkable(nx, ny) && ny * columns + nx != targetCell) continue;
+                bool diagonal = n >= 4;
+                if (diagonal && (!walkable(x + NEIGHBOUR_X[n], y) || !walkable(x, y + NEIGHBOUR_Y[n]))) continue;
+
+                uint32_t neighbourCost = cost[ny * columns + nx];
+                if (neighbourCost < best) {
+                    best = neighbourCost;
+                    float step = diagonal ? diagonalStep : 1.0f;
+                    direction[cell] = sf::Vector2f(NEIGHBOUR_X[n] * step, NEIGHBOUR_Y[n] * step);
+                }
+            }
+        }
+    }
+}
+
+sf::Vector2f FlowField::directionAt(sf::Vector2f position) const {
+    if (targetCell < 0) return sf::Vector2f();
+    return direction[cellAt(position)];
+}
+
+bool FlowField::isBlocked(sf::Vector2f position) const {
+    return blocked[cellAt(position)] != 0;
+}
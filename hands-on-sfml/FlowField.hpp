@@ -0,0 +1,51 @@
+#ifndef FLOWFIELD_HPP
+#define FLOWFIELD_HPP
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Shared pathfinding for every zombie. Obstacles are rasterised once into an occupancy grid,
+// inflated by the agent size so a free cell is free for the whole agent. Whenever the target
+// enters a new cell, a Dijkstra pass (8-way, no corner cutting) fills in the path cost from
+// the target, and each cell stores the step toward its cheapest neighbour. Agents then steer
+// with one lookup, whatever the number or shape of the obstacles.
+class FlowField {
+public:
+    FlowField(const sf::FloatRect& worldBounds, float cellSize);
+
+    // Agents are anchored at their top-left corner, like sf::FloatRect(position, extent)
+    void setObstacles(const std::vector<sf::FloatRect>& obstacles, sf::Vector2f agentExtent);
+
+    // Recomputes the field if the target moved to another cell; returns true when it did
+    bool update(sf::Vector2f target);
+
+    // Unit step toward the target. (0, 0) means nothing is in the way and the agent can head
+    // straight for the target: the target cell itself, cells whose shortest path has no detour,
+    // and cells the target cannot be reached from.
+    sf::Vector2f directionAt(sf::Vector2f position) const;
+
+    bool isBlocked(sf::Vector2f position) const;
+    int getColumns() const { return columns; }
+    int getRows() const { return rows; }
+
+private:
+    sf::FloatRect worldBounds;
+    float cellSize;
+    float inverseCellSize;
+    int columns;
+    int rows;
+    int targetCell = -1;
+
+    std::vector<uint8_t> blocked;
+    std::vector<uint32_t> cost;
+    std::vector<sf::Vector2f> direction;
+    std::vector<std::pair<uint32_t, int>> open;   // reused heap storage
+
+    int cellAt(sf::Vector2f position) const;
+    void rebuild();
+};
+
+#endif // FLOWFIELD_HPP
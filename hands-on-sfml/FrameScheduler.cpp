@@ -0,0 +1,45 @@
+#include "FrameScheduler.hpp"
+#include "Constants.hpp"
+#include <SFML/System/Sleep.hpp>
+
+FrameScheduler::FrameScheduler(unsigned int framesPerSecond) {
+    setFrameRate(framesPerSecond);
+}
+
+void FrameScheduler::setFrameRate(unsigned int framesPerSecond) {
+    if (framesPerSecond == frameRate) return;
+    frameRate = framesPerSecond;
+    period = frameRate > 0 ? sf::seconds(1.0f / frameRate) : sf::Time::Zero;
+    resync();
+}
+
+void FrameScheduler::resync() {
+    deadline = clock.getElapsedTime() + period;
+}
+
+void FrameScheduler::waitForNextFrame() {
+    if (frameRate == 0) return;
+
+    sf::Time spinMargin = sf::milliseconds(FRAME_SPIN_MARGIN_MS);
+    sf::Time now = clock.getElapsedTime();
+    if (deadline - now > spinMargin) {
+        sf::sleep(deadline - now - spinMargin);
+    }
+    while (clock.getElapsedTime() < deadline) {
+        // Spin: the last stretch is shorter than the sleep granularity
+    }
+
+    // Missed by more than a frame (a hitch, a breakpoint): start over rather than rush to catch up
+    now = clock.getElapsedTime();
+    deadline += period;
+    if (deadline < now) deadline = now + period;
+}
+
+bool FrameScheduler::waitEvent(sf::Window& window, sf::Event& event, sf::Time timeout) {
+    sf::Clock waited;
+    for (;;) {
+        if (window.pollEvent(event)) return true;
+        if (!window.isOpen() || waited.getElapsedTime() >= timeout) return false;
+        sf::sleep(sf::milliseconds(IDLE_POLL_INTERVAL_MS));
+    }
+}
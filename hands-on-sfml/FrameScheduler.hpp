@@ -0,0 +1,35 @@
+#ifndef FRAMESCHEDULER_HPP
+#define FRAMESCHEDULER_HPP
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/Window/Event.hpp>
+#include <SFML/Window/Window.hpp>
+
+// Paces the main loop to a target frame rate. The OS sleep is only accurate to a millisecond
+// or so, so it sleeps until shortly before the deadline and spins the rest of the way.
+// Deadlines advance by whole periods, so one late frame does not shift every frame after it.
+class FrameScheduler {
+public:
+    explicit FrameScheduler(unsigned int framesPerSecond);
+
+    // 0 runs unpaced
+    void setFrameRate(unsigned int framesPerSecond);
+    unsigned int getFrameRate() const { return frameRate; }
+
+    void waitForNextFrame();
+    // Starts the deadlines afresh, e.g. after the loop has been blocked on events
+    void resync();
+
+    // Blocks until the window has an event or 'timeout' passes; true if 'event' was filled.
+    // SFML 2 has no waitEvent with a timeout, so this polls with short sleeps in between.
+    static bool waitEvent(sf::Window& window, sf::Event& event, sf::Time timeout);
+
+private:
+    unsigned int frameRate = 0;
+    sf::Time period;
+    sf::Time deadline;
+    sf::Clock clock;
+};
+
+#endif // FRAMESCHEDULER_HPP
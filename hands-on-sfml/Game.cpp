@@ -1,59 +1,52 @@
 #include "Game.hpp"
+#include "Helper.hpp"
+#include <cmath>
+
+namespace {
+    // Atlas regions of the obstacle kinds, indexed by ChunkWorld's kind
+    const char* const OBSTACLE_REGIONS[] = { "pillar", "block", "vase", "water" };
+
+    // The main thread renders and, when threaded, another one simulates; the pool gets the rest
+    unsigned int poolWorkers() {
+        unsigned int cores = std::max(1u, std::thread::hardware_concurrency());
+        unsigned int reserved = THREADED_SIMULATION ? 2 : 1;
+        return cores > reserved ? cores - reserved : 0;
+    }
+}
 
-Game::Game() : window(sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT), "Red Alert"), gameState(GameState::MENU), menu(loadHighScore()) {
+Game::Game(unsigned int seed, float worldSize, int obstaclesPerChunk)
+    : window(sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT), "Red Alert"),
+    highScores(HIGH_SCORE_PATH), threads(poolWorkers()),
+    sim(seed, worldSize), input(&keyboardInput), scheduler(FRAME_RATE_LIMIT),
+    minimap(MINIMAP_SIZE, sim.world.getActiveArea().width, MINIMAP_REFRESH_RATE),
+    gameState(GameState::LOADING), previousState(GameState::LOADING),
+    menu(resources, highScores.get()), gameOverScreen(resources), simThread(sim),
+    assets(ASYNC_ASSET_LOADING ? std::min(ASSET_LOADER_THREADS, std::max(1u, std::thread::hardware_concurrency())) : 0) {
+    TRACE_THREAD_NAME("main");
     cameraView.setSize(WINDOW_WIDTH, WINDOW_HEIGHT);
     cameraView.setCenter(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2);
+    sim.world.setGeneratedObstaclesPerChunk(obstaclesPerChunk);
 
-    playerTexture.loadFromFile("assets/player.png");
-    bulletTexture.loadFromFile("assets/bullet.png");
-    zombieTexture.loadFromFile("assets/zombie.png");
-    zombieBulletTexture.loadFromFile("assets/zombie_bullet.png");
-
-    player = new Player(playerTexture);
-    player->health = PLAYER_MAX_HEALTH;
+    // Already loaded by the menu; the loading screen needs it before anything else
+    font = resources.getFont("arial.ttf");
 
-    powerUpHealthTexture.loadFromFile("assets/powerup_health.png");
-    powerUpSpeedTexture.loadFromFile("assets/powerup_speed.png");
-    powerUpDamageTexture.loadFromFile("assets/powerup_damage.png");
+    loadingText.setFont(*font);
+    loadingText.setCharacterSize(24);
+    loadingText.setFillColor(sf::Color::White);
+    loadingText.setPosition(WINDOW_WIDTH / 2 - 200, WINDOW_HEIGHT / 2 - 50);
 
-    if (!backgroundTexture.loadFromFile("assets/background.jpg")) {
-        std::cerr << "Error loading background image!\n";
-    }
+    loadingBarBack.setSize(sf::Vector2f(400, 20));
+    loadingBarBack.setFillColor(sf::Color(50, 50, 50));
+    loadingBarBack.setPosition(WINDOW_WIDTH / 2 - 200, WINDOW_HEIGHT / 2);
+    loadingBar.setFillColor(sf::Color::Red);
+    loadingBar.setPosition(loadingBarBack.getPosition());
 
-    if (!blockTexture.loadFromFile("assets/block.png")) {
-        std::cerr << "Error loading obstacle texture!\n";
-    }
-    if (!waterTexture.loadFromFile("assets/water.jpg")) {
-        std::cerr << "Error loading obstacle texture!\n";
-    }
-    if (!vaseTexture.loadFromFile("assets/vase.png")) {
-        std::cerr << "Error loading obstacle texture!\n";
-    }
-    if (!pillarTexture.loadFromFile("assets/cloud.png")) {
-        std::cerr << "Error loading obstacle texture!\n";
-    }
-
-    backgroundSprite.setTexture(backgroundTexture);
-    backgroundSprite.setScale(
-        float(2000) / backgroundTexture.getSize().x,
-        float(2000) / backgroundTexture.getSize().y
-    );
-
-    pauseText.setFont(font);
+    pauseText.setFont(*font);
     pauseText.setString("Game Paused\nPress P to Resume");
     pauseText.setCharacterSize(30);
     pauseText.setFillColor(sf::Color::White);
     pauseText.setPosition(WINDOW_WIDTH / 2 - 120, WINDOW_HEIGHT / 2 - 50);
 
-    player = new Player(playerTexture);
-    srand(static_cast<unsigned>(time(0)));
-    healthBar.setSize(sf::Vector2f(200, 20));
-    healthBar.setFillColor(sf::Color::White);
-    healthBar.setPosition(10, WINDOW_HEIGHT - 30);
-
-    font.loadFromFile("arial.ttf");
-    zombieKillText.setFont(font);
-
     pauseOverlay.setSize(sf::Vector2f(WINDOW_WIDTH, WINDOW_HEIGHT));
     pauseOverlay.setFillColor(sf::Color(0, 0, 0, 150));
 
@@ -63,329 +56,512 @@ Game::Game() : window(sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT), "Red Alert"),
     pauseMenu.setOutlineThickness(3);
     pauseMenu.setPosition(WINDOW_WIDTH / 2 - 150, WINDOW_HEIGHT / 2 - 100);
 
-    resumeText.setFont(font);
+    resumeText.setFont(*font);
     resumeText.setString("Resume");
     resumeText.setCharacterSize(28);
     resumeText.setFillColor(sf::Color::White);
     resumeText.setPosition(WINDOW_WIDTH / 2 - 50, WINDOW_HEIGHT / 2 - 50);
 
-    exitText.setFont(font);
+    exitText.setFont(*font);
     exitText.setString("Exit");
     exitText.setCharacterSize(28);
     exitText.setFillColor(sf::Color::White);
     exitText.setPosition(WINDOW_WIDTH / 2 - 30, WINDOW_HEIGHT / 2 + 20);
 
-    zombieKillText.setCharacterSize(20);
-    zombieKillText.setFillColor(sf::Color::White);
-    zombieKillText.setPosition(10, WINDOW_HEIGHT - 60);
+    renderStatsText.setFont(*font);
+    renderStatsText.setCharacterSize(16);
+    renderStatsText.setFillColor(sf::Color::Yellow);
+    renderStatsText.setPosition(10, 10);
 
-    obstacles.emplace_back(pillarTexture, sf::Vector2f(1000, 800));
-    obstacles.emplace_back(pillarTexture, sf::Vector2f(300, 1200));
+    profilerOverlay.reset(new ProfilerOverlay(*font));
+    hud.reset(new Hud(*font));
 
+    queueAssets();
+    if (!ASYNC_ASSET_LOADING) {
+        // Everything was decoded inline by queueAssets(); upload it before the first frame
+        assets.finish();
+        finishLoading();
+    }
+}
 
-    // Mini-map View 
-    miniMapView.setSize(2000, 2000);
-    miniMapView.setViewport(sf::FloatRect(0.75f, 0.75f, 0.2f, 0.2f));
+void Game::queueAssets() {
+    // Every entity and obstacle image shares one atlas page, so the world draws from a single texture
+    atlas.add("player", "assets/player.png");
+    atlas.add("bullet", "assets/bullet.png");
+    atlas.add("zombie", "assets/zombie.png");
+    atlas.add("zombie_bullet", "assets/zombie_bullet.png");
+    atlas.add("powerup_health", "assets/powerup_health.png");
+    atlas.add("powerup_speed", "assets/powerup_speed.png");
+    atlas.add("powerup_damage", "assets/powerup_damage.png");
+    atlas.add("block", "assets/block.png");
+    atlas.add("water", "assets/water.jpg");
+    atlas.add("vase", "assets/vase.png");
+    atlas.add("pillar", "assets/cloud.png");
+
+    // The atlas is the longest job, so it is queued first
+    assets.add("atlas",
+        [this] {
+            atlasComplete = atlas.prepare(USE_ATLAS_CACHE ? ATLAS_CACHE_PREFIX : "");
+            return true;
+        },
+        [this] {
+            if (!atlas.upload() || !atlasComplete) {
+                std::cerr << "Error building texture atlas!\n";
+                return false;
+            }
+            return true;
+        });
+
+    backgroundTexture = resources.getTexture("assets/background.jpg", &assets);
+    menu.loadBackground(&assets);
+
+    // Opening the stream reads the file header; playback itself starts on the main thread
+    assets.add("music",
+        [this] {
+            if (!backgroundMusic.openFromFile("assets/World War Z Theme Song.ogg")) {
+                std::cerr << "Error loading background music!" << std::endl;
+                return false;
+            }
+            return true;
+        },
+        [this] {
+            backgroundMusic.setLoop(true);
+            backgroundMusic.setVolume(100);
+            backgroundMusic.play();
+            return true;
+        });
+}
 
-    if (!backgroundMusic.openFromFile("assets/World War Z Theme Song.ogg")) {
-        std::cerr << "Error loading background music!" << std::endl;
+void Game::updateLoading() {
+    // A couple of uploads per frame keeps the loading screen responsive
+    if (assets.update(ASSET_UPLOADS_PER_FRAME)) {
+        finishLoading();
     }
-    else {
-        backgroundMusic.setLoop(true);
-        backgroundMusic.setVolume(100);
-        backgroundMusic.play();
+}
+
+void Game::finishLoading() {
+    // One template sprite per texture; entities only carry a TextureId and are stamped out at draw time
+    struct SpriteSetup { TextureId id; const char* region; float scale; };
+    const SpriteSetup spriteSetups[] = {
+        { TextureId::Player, "player", 0.25f },
+        { TextureId::Bullet, "bullet", BULLET_SCALE },
+        { TextureId::ZombieBullet, "zombie_bullet", BULLET_SCALE },
+        { TextureId::Zombie, "zombie", ZOMBIE_SCALE },
+        { TextureId::PowerUpHealth, "powerup_health", POWERUP_SCALE },
+        { TextureId::PowerUpSpeed, "powerup_speed", POWERUP_SCALE },
+        { TextureId::PowerUpDamage, "powerup_damage", POWERUP_SCALE },
+    };
+    for (const auto& setup : spriteSetups) {
+        const TextureAtlas::Region& region = atlas.get(setup.region);
+        sf::Sprite& sprite = entitySprites[static_cast<int>(setup.id)];
+        sprite.setTexture(atlas.getPage(region.page));
+        sprite.setTextureRect(region.rect);
+        sprite.setScale(setup.scale, setup.scale);
     }
 
+    // The player rotates about its centre; everything else is drawn from its top-left corner
+    sf::Sprite& playerSprite = entitySprites[static_cast<int>(TextureId::Player)];
+    playerSprite.setOrigin(playerSprite.getLocalBounds().width / 2, playerSprite.getLocalBounds().height / 2);
+
+    auto scaledSize = [this](const char* region, float scale) {
+        const sf::IntRect& rect = atlas.get(region).rect;
+        return sf::Vector2f(static_cast<float>(rect.width), static_cast<float>(rect.height)) * scale;
+    };
+    // The simulation only needs collision sizes, taken from the scaled images
+    sim.player.extent = scaledSize("player", 0.25f);
+    sim.store.bullets.extent = scaledSize("bullet", BULLET_SCALE);
+    sim.store.zombieBullets.extent = scaledSize("zombie_bullet", BULLET_SCALE);
+    sim.store.zombies.extent = scaledSize("zombie", ZOMBIE_SCALE);
+    sim.store.powerUps.extent = scaledSize("powerup_health", POWERUP_SCALE);
+
+    // The background tiles across worlds larger than the one it was painted for
+    backgroundTexture->setRepeated(true);
+    backgroundSprite.setTexture(*backgroundTexture, true);
+    menu.finishLoading();
+
+    // Generated obstacles use these images, in the order of their kind index; kind 0 is also
+    // what the hand-placed ones are drawn with
+    std::vector<sf::Vector2f> obstacleSizes;
+    for (const char* region : OBSTACLE_REGIONS)
+        obstacleSizes.push_back(scaledSize(region, 1.0f));
+    sim.world.setObstacleKinds(obstacleSizes);
+
+    sf::Vector2f pillarSize = obstacleSizes[0];
+    sim.setObstacles({ sf::FloatRect(sf::Vector2f(1000, 800), pillarSize), sf::FloatRect(sf::Vector2f(300, 1200), pillarSize) });
+    sim.setThreadPool(&threads);
+
+    minimap.setPosition(sf::Vector2f(WINDOW_WIDTH * 0.75f, WINDOW_HEIGHT * 0.75f));
+
+    // A replay starts straight away, from the same state the recording did
+    gameState = replay ? GameState::PLAYING : GameState::MENU;
+    replayClock.restart();
+    std::cout << "Time to interactive: " << startupClock.getElapsedTime().asMilliseconds() << " ms";
+    if (assets.getFailedCount() > 0) std::cout << " (" << assets.getFailedCount() << " assets failed)";
+    std::cout << std::endl;
+    resources.report(std::cout);
+}
 
+void Game::startSimulation() {
+    // Input sources are final once run() has started; from here on only snapshots are read
+    simThread.setInput(input, recorder.get(), replay.get());
+    simThread.setTickRate(simTickRate);
+    simThread.setFastForward(fastReplay);
+    simThread.start(THREADED_SIMULATION);
 }
 
-Game::~Game() {
-    delete player;
+void Game::syncWorld(const WorldSnapshot& snapshot) {
+    // Obstacle sprites, background and the minimap's static layer only change when the active
+    // window moves; everything is in the simulation's local coordinates
+    worldVersion = snapshot.worldVersion;
+    const std::vector<sf::FloatRect>& bounds = snapshot.obstacles;
+    const std::vector<int>& kinds = snapshot.obstacleKinds;
+    obstacleTree.build(bounds);
+    obstacles.clear();
+    for (size_t i = 0; i < bounds.size(); ++i) {
+        const TextureAtlas::Region& region = atlas.get(OBSTACLE_REGIONS[kinds[i]]);
+        obstacles.emplace_back(atlas.getPage(region.page), region.rect, sf::Vector2f(bounds[i].left, bounds[i].top));
+    }
+
+    // Offset the repeating background by where the window starts in the world, so it stays put
+    // while the local origin moves
+    sf::Vector2u textureSize = backgroundTexture->getSize();
+    sf::Vector2f scale(BACKGROUND_TILE_SIZE / textureSize.x, BACKGROUND_TILE_SIZE / textureSize.y);
+    sf::Vector2i origin = snapshot.worldOrigin;
+    float offsetX = std::fmod(origin.x * snapshot.chunkSize, BACKGROUND_TILE_SIZE);
+    float offsetY = std::fmod(origin.y * snapshot.chunkSize, BACKGROUND_TILE_SIZE);
+    const sf::FloatRect& active = snapshot.activeBounds;
+    backgroundSprite.setTextureRect(sf::IntRect(
+        static_cast<int>(offsetX / scale.x + 0.5f), static_cast<int>(offsetY / scale.y + 0.5f),
+        static_cast<int>(active.width / scale.x + 0.5f), static_cast<int>(active.height / scale.y + 0.5f)));
+    backgroundSprite.setScale(scale);
+
+    minimap.bake(backgroundSprite, obstacles);
 }
 
-void Game::run() {
-    while (window.isOpen()) {
-        handleEvents();
-        update();
-        render();
+void Game::onStateChanged() {
+    // The menu background is the largest texture and is only needed while the menu is up
+    if (previousState == GameState::MENU) {
+        menu.releaseBackground();
+    }
+    else if (gameState == GameState::MENU && previousState != GameState::LOADING) {
+        menu.loadBackground();
+    }
+    previousState = gameState;
+
+    size_t released = resources.evictUnused();
+    if (released > 0) {
+        std::cout << "Released " << released / 1024 << " KB, " << resources.getResidentBytes() / 1024 << " KB resident" << std::endl;
     }
 }
 
-void Game::spawnPowerUp() {
-    if (powerUpSpawnClock.getElapsedTime().asSeconds() > 10) {
-        sf::Vector2f spawnPosition(rand() % WINDOW_WIDTH, rand() % WINDOW_HEIGHT);
-        int randomType = rand() % 3;
-        sf::Texture* chosenTexture = nullptr;
-
-        switch (randomType) {
-        case 0: chosenTexture = &powerUpHealthTexture; break;
-        case 1: chosenTexture = &powerUpSpeedTexture; break;
-        case 2: chosenTexture = &powerUpDamageTexture; break;
-        default: chosenTexture = &powerUpHealthTexture; break;
+void Game::run() {
+    sf::Clock frameClock;
+
+    while (window.isOpen()) {
+        // Static screens sleep until something happens instead of redrawing the same picture;
+        // the wait sits outside the profiled frame so it never reads as a spike
+        sf::Event wakeEvent;
+        bool woken = false;
+        if (isIdle()) {
+            woken = FrameScheduler::waitEvent(window, wakeEvent, sf::milliseconds(IDLE_WAKE_INTERVAL_MS));
+            scheduler.resync();
+            // The wait is not simulated time; unpausing must not replay it as a burst of ticks
+            frameClock.restart();
         }
 
-        if (chosenTexture) {
-            powerUps.emplace_back(*chosenTexture, spawnPosition, static_cast<PowerUp::Type>(randomType));
-            powerUpSpawnClock.restart();
+        PROFILE_FRAME_BEGIN();
+        float frameSeconds = frameClock.restart().asSeconds();
+
+        {
+            PROFILE_SCOPE("events");
+            handleEvents(woken ? &wakeEvent : nullptr);
+        }
+        if (gameState == GameState::LOADING) {
+            PROFILE_SCOPE("loading");
+            updateLoading();
+        }
+        if (gameState != GameState::LOADING && !simThread.isStarted()) {
+            startSimulation();
+        }
+
+        if (simThread.isStarted()) {
+            // Threaded, the ticks overlap this frame instead of running inside it
+            simThread.setRunning((gameState == GameState::PLAYING || gameState == GameState::GAME_OVER) && !isPaused);
+            if (!simThread.isThreaded()) {
+                PROFILE_SCOPE("simulate");
+                simThread.advance(frameSeconds);
+            }
+
+            const WorldSnapshot& snapshot = simThread.acquire();
+            {
+                PROFILE_SCOPE("update");
+                update(snapshot);
+            }
+            TRACE_COUNTER("zombies", snapshot.store.zombies.size());
+            TRACE_COUNTER("bullets", snapshot.store.bullets.size());
+            TRACE_COUNTER("zombie_bullets", snapshot.store.zombieBullets.size());
+            {
+                PROFILE_SCOPE("render");
+                render(snapshot, simThread.getAlpha(snapshot));
+            }
+        }
+        else {
+            PROFILE_SCOPE("render");
+            renderLoading();
+        }
+        PROFILE_FRAME_END();
+
+        if (!firstFrameShown) {
+            firstFrameShown = true;
+            std::cout << "Time to first frame: " << startupClock.getElapsedTime().asMilliseconds() << " ms" << std::endl;
+        }
+
+        if (gameState != previousState) {
+            onStateChanged();
+        }
+        if (!isIdle()) {
+            scheduler.waitForNextFrame();
         }
     }
-}
 
-void Game::checkHighScore() {
-    int savedHighScore = loadHighScore();
-    if (zombiesKilled > savedHighScore) {
-        highScore = zombiesKilled;
-        saveHighScore();
-        menu.updateHighScore(highScore);
+    simThread.stop();
+    if (recorder) {
+        recording.finalStateHash = sim.hashState();
+        if (recording.save(recordingPath)) {
+            std::cout << "Recorded " << recording.ticks.size() << " ticks to " << recordingPath << std::endl;
+        }
     }
-    else {
-        highScore = savedHighScore;
+
+#if PROFILER_ENABLED
+    Profiler::get().dump(PROFILER_DUMP_PREFIX);
+#endif
+}
+
+void Game::setSimulationRate(float ticksPerSecond) {
+    if (ticksPerSecond > 0) {
+        simTickRate = ticksPerSecond;
     }
 }
 
+void Game::setFrameRateLimit(unsigned int framesPerSecond) {
+    // 0 disables the cap; the simulation rate is unaffected either way
+    frameRateLimit = framesPerSecond;
+    applyFrameRate();
+}
 
+void Game::applyFrameRate() {
+    // Nobody is watching closely while another window has focus
+    unsigned int rate = frameRateLimit;
+    if (fastReplay) rate = 0;
+    else if (!hasFocus) rate = rate == 0 ? UNFOCUSED_FRAME_RATE : std::min(rate, UNFOCUSED_FRAME_RATE);
+    scheduler.setFrameRate(rate);
+}
 
-void Game::checkPowerUpCollisions() {
-    for (auto it = powerUps.begin(); it != powerUps.end();) {
-        if (it->sprite.getGlobalBounds().intersects(player->sprite.getGlobalBounds())) {
-            it->applyEffect(*player);
-            it = powerUps.erase(it);
-        }
-        else {
-            ++it;
-        }
+bool Game::isIdle() const {
+    // Nothing moves on these screens until there is input; a replay keeps ticking through them
+    if (replay || gameState == GameState::LOADING) return false;
+    return gameState == GameState::MENU || gameState == GameState::GAME_OVER || isPaused;
+}
+
+void Game::setInputSource(InputSource* source) {
+    input = source ? source : &keyboardInput;
+}
+
+void Game::setTraceBudget(float milliseconds) {
+    // Frames longer than this are written out as a Chrome trace
+    if (milliseconds > 0) {
+        TraceRecorder::get().setSpikeBudget(milliseconds);
     }
 }
 
-void Game::restartGame() {
-    gameState = GameState::PLAYING;
-    zombiesKilled = 0;
-    bullets.clear();
-    zombies.clear();
-    zombieBullets.clear();
-    player->health = PLAYER_MAX_HEALTH;
-    player->sprite.setPosition(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2);
-    spawnClock.restart();
-    powerUps.clear();
-    powerUpSpawnClock.restart();
+void Game::recordTo(const std::string& path) {
+    recording = InputRecording();
+    recording.seed = sim.getSeed();
+    recording.tickRate = simTickRate;
+    recording.zombieSpawnInterval = sim.getZombieSpawnInterval();
+    recording.worldSize = sim.world.getWorldSize();
+    recording.obstaclesPerChunk = sim.world.getGeneratedObstaclesPerChunk();
+    recordingPath = path;
+    recorder.reset(new InputRecorder(*input, recording));
+    input = recorder.get();
 }
 
+void Game::playRecording(const InputRecording& recorded, bool asFastAsPossible) {
+    if (recorded.seed != sim.getSeed()) {
+        std::cerr << "Error: the recording was made with seed " << recorded.seed << ", not " << sim.getSeed() << "!\n";
+    }
+    if (recorded.worldSize != sim.world.getWorldSize() || recorded.obstaclesPerChunk != sim.world.getGeneratedObstaclesPerChunk()) {
+        std::cerr << "Error: the recording was made in a " << recorded.worldSize << " world with "
+            << recorded.obstaclesPerChunk << " obstacles per chunk!\n";
+    }
+    simTickRate = recorded.tickRate;
+    sim.setZombieSpawnInterval(recorded.zombieSpawnInterval);
+    replay.reset(new ReplayInput(recorded));
+    input = replay.get();
 
+    fastReplay = asFastAsPossible;
+    applyFrameRate();
+}
 
-void Game::handleEvents() {
-    sf::Event event;
-    while (window.pollEvent(event)) {
-        if (event.type == sf::Event::Closed)
-            window.close();
+void Game::finishReplay(const WorldSnapshot& snapshot) {
+    if (!window.isOpen()) return;
 
-        if (gameState == GameState::MENU) {
-            menu.handleInput(window, gameState, backgroundMusic);
-            return;
-        }
+    float seconds = replayClock.getElapsedTime().asSeconds();
+    bool matches = snapshot.stateHash == replay->getRecording().finalStateHash;
+    std::cout << "Replayed " << snapshot.tick << " ticks in " << seconds << " s ("
+        << snapshot.tick / std::max(seconds, 0.001f) << " ticks/s); final state "
+        << (matches ? "matches" : "DIFFERS FROM") << " the recording" << std::endl;
+    window.close();
+}
 
-        if (event.type == sf::Event::KeyPressed) {
-            if (event.key.code == sf::Keyboard::P) {
-                isPaused = !isPaused;
-            }
-        }
+void Game::checkHighScore(int kills) {
+    // A replay is not a new game, so it never sets a high score
+    if (replay) return;
 
-        if (isPaused) {
-            if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Left) {
-                sf::Vector2i mousePos = sf::Mouse::getPosition(window);
-                sf::Vector2f worldMousePos = window.mapPixelToCoords(mousePos);
-
-                if (resumeText.getGlobalBounds().contains(worldMousePos)) {
-                    isPaused = false;
-                }
-                else if (exitText.getGlobalBounds().contains(worldMousePos)) {
-                    window.close();
-                }
-            }
-        }
+    // In-memory check; the store writes the file on its own thread
+    if (highScores.submit(kills)) {
+        highScore = kills;
+        menu.updateHighScore(highScore);
+    }
+    else {
+        highScore = highScores.get();
+    }
+}
 
-        else if (gameState == GameState::GAME_OVER) {
-            if (event.type == sf::Event::KeyPressed) {
-                if (event.key.code == sf::Keyboard::R) {
-                    restartGame();
-                }
-                else if (event.key.code == sf::Keyboard::Escape) {
-                    window.close();
-                }
-            }
 
-            if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Left) {
-                sf::Vector2i mousePos = sf::Mouse::getPosition(window);
-                sf::Vector2f worldMousePos = window.mapPixelToCoords(mousePos);
 
-                if (gameOverScreen.restartText.getGlobalBounds().contains(worldMousePos)) {
-                    restartGame();
-                }
-                else if (gameOverScreen.exitText.getGlobalBounds().contains(worldMousePos)) {
-                    window.close();
-                }
-            }
-        }
+void Game::restartGame() {
+    // Applied between two ticks; the round starts once a snapshot shows it happened
+    simThread.requestRestart();
+    requestedRestarts++;
+}
 
-        else {
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Space)) {
-                bullets.emplace_back(bulletTexture, player->sprite.getPosition(), player->getDirection());
-            }
-        }
+
+
+void Game::handleEvents(const sf::Event* first) {
+    sf::Event event;
+    if (first) {
+        handleEvent(*first);
+    }
+    while (window.pollEvent(event)) {
+        handleEvent(event);
     }
 
     if (gameState == GameState::MENU) {
         menu.handleInput(window, gameState, backgroundMusic);
     }
-
 }
 
+void Game::handleEvent(const sf::Event& event) {
+    if (event.type == sf::Event::Closed)
+        window.close();
 
+    if (event.type == sf::Event::LostFocus || event.type == sf::Event::GainedFocus) {
+        hasFocus = event.type == sf::Event::GainedFocus;
+        applyFrameRate();
+    }
 
-void Game::checkCollisions() {
-    for (auto bulletIt = bullets.begin(); bulletIt != bullets.end();) {
+    // The menu reads the mouse once per frame, after the event loop, so a burst of
+    // moves drains into a single redraw
+    if (gameState == GameState::LOADING || gameState == GameState::MENU) {
+        return;
+    }
 
-        if (bulletIt->sprite.getPosition().x < 0 || bulletIt->sprite.getPosition().x > 2000 ||
-            bulletIt->sprite.getPosition().y < 0 || bulletIt->sprite.getPosition().y > 2000) {
-            bulletIt = bullets.erase(bulletIt);
-            continue;
+    if (event.type == sf::Event::KeyPressed) {
+        if (event.key.code == sf::Keyboard::P) {
+            isPaused = !isPaused;
+        }
+        else if (event.key.code == sf::Keyboard::F3) {
+            showRenderStats = !showRenderStats;
+        }
+        else if (event.key.code == sf::Keyboard::F2) {
+            showProfiler = !showProfiler;
+        }
+        else if (event.key.code == sf::Keyboard::F5) {
+            Profiler::get().dump(PROFILER_DUMP_PREFIX);
         }
+    }
 
-        bool bulletRemoved = false;
+    if (isPaused) {
+        if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Left) {
+            sf::Vector2i mousePos = sf::Mouse::getPosition(window);
+            sf::Vector2f worldMousePos = window.mapPixelToCoords(mousePos);
 
-        // Check if bullet hits an obstacle
-        for (auto& obstacle : obstacles) {
-            if (bulletIt->sprite.getGlobalBounds().intersects(obstacle.sprite.getGlobalBounds())) {
-                bulletIt = bullets.erase(bulletIt);
-                bulletRemoved = true;
-                break;
+            if (resumeText.getGlobalBounds().contains(worldMousePos)) {
+                isPaused = false;
+            }
+            else if (exitText.getGlobalBounds().contains(worldMousePos)) {
+                window.close();
             }
         }
-        if (bulletRemoved) continue;
-
-        // Check if bullet hits a zombie
-        for (auto zombieIt = zombies.begin(); zombieIt != zombies.end();) {
-            if (bulletIt->sprite.getGlobalBounds().intersects(zombieIt->sprite.getGlobalBounds())) {
-                zombieIt->health--;
-                bulletIt = bullets.erase(bulletIt);
-                bulletRemoved = true;
-                if (zombieIt->health <= 0) {
-                    zombiesKilled++;
-                    zombieIt = zombies.erase(zombieIt);
-                    checkHighScore();
-                }
-                break;
+    }
+
+    // During a replay only the recording may restart the round
+    else if (gameState == GameState::GAME_OVER && !replay) {
+        if (event.type == sf::Event::KeyPressed) {
+            if (event.key.code == sf::Keyboard::R) {
+                restartGame();
             }
-            else {
-                ++zombieIt;
+            else if (event.key.code == sf::Keyboard::Escape) {
+                window.close();
             }
         }
-        if (!bulletRemoved) {
-            ++bulletIt;
-        }
-    }
 
-    for (auto zombieBulletIt = zombieBullets.begin(); zombieBulletIt != zombieBullets.end();) {
-        bool zombieBulletRemoved = false;
+        if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Left) {
+            sf::Vector2i mousePos = sf::Mouse::getPosition(window);
+            sf::Vector2f worldMousePos = window.mapPixelToCoords(mousePos);
 
-        // Check if zombie bullet hits an obstacle
-        for (auto& obstacle : obstacles) {
-            if (zombieBulletIt->sprite.getGlobalBounds().intersects(obstacle.sprite.getGlobalBounds())) {
-                zombieBulletIt = zombieBullets.erase(zombieBulletIt);
-                zombieBulletRemoved = true;
-                break;
+            if (gameOverScreen.restartText.getGlobalBounds().contains(worldMousePos)) {
+                restartGame();
             }
-        }
-        if (zombieBulletRemoved) continue;
-
-        // Check if zombie bullet hits player
-        if (zombieBulletIt->sprite.getGlobalBounds().intersects(player->sprite.getGlobalBounds())) {
-            player->health--;
-            zombieBulletIt = zombieBullets.erase(zombieBulletIt);
-            if (player->health <= 0) {
-                checkHighScore();
-                int savedHighScore = loadHighScore();
-                gameOverScreen.setFinalScore(zombiesKilled, savedHighScore);
-                gameState = GameState::GAME_OVER;
+            else if (gameOverScreen.exitText.getGlobalBounds().contains(worldMousePos)) {
+                window.close();
             }
-
-        }
-        else {
-            ++zombieBulletIt;
         }
     }
 }
 
 
-void Game::update() {
-    if (gameState == GameState::MENU) {
+
+void Game::update(const WorldSnapshot& snapshot) {
+    if (gameState == GameState::LOADING || gameState == GameState::MENU) {
         return;
     }
 
-    if (!isPaused) {
-        player->move(obstacles);
-        player->updateBoosts();
-        spawnPowerUp();
-        checkPowerUpCollisions();
-
-        miniMapView.setCenter(player->sprite.getPosition());
-
-        sf::Vector2f playerPos = player->sprite.getPosition();
-        float halfWidth = WINDOW_WIDTH / 2;
-        float halfHeight = WINDOW_HEIGHT / 2;
-
-        float minX = halfWidth, minY = halfHeight;
-        float maxX = 2000 - halfWidth;
-        float maxY = 2000 - halfHeight;
-
-        float cameraX = std::max(minX, std::min(maxX, playerPos.x));
-        float cameraY = std::max(minY, std::min(maxY, playerPos.y));
-
-        cameraView.setCenter(cameraX, cameraY);
-        window.setView(cameraView);
-
-        // Update bullets
-        for (auto& bullet : bullets)
-            bullet.update(0);
-
-        for (auto& zombieBullet : zombieBullets)
-            zombieBullet.update(0);
-
-        for (auto& zombie : zombies)
-            zombie.update(0, player->sprite.getPosition(), zombieBullets, zombieBulletTexture, obstacles);
-
-        checkCollisions();
-
-        // Zombie spawning logic
-        if (spawnClock.getElapsedTime().asSeconds() > zombieSpawnInterval) {
-            sf::Vector2f spawnPosition(rand() % WINDOW_WIDTH, rand() % WINDOW_HEIGHT);
-
-            // Ensure zombies don't spawn inside obstacles
-            bool validSpawn = true;
-            for (auto& obstacle : obstacles) {
-                if (sf::FloatRect(spawnPosition.x, spawnPosition.y, 40, 40).intersects(obstacle.sprite.getGlobalBounds())) {
-                    validSpawn = false;
-                    break;
-                }
-            }
+    if (snapshot.replayFinished) {
+        finishReplay(snapshot);
+        return;
+    }
 
-            if (validSpawn) {
-                zombies.emplace_back(zombieTexture, spawnPosition);
-            }
+    // Restarts come from the R key or from a replay's recording
+    if (snapshot.restarts > seenRestarts) {
+        seenRestarts = snapshot.restarts;
+        gameState = GameState::PLAYING;
+        reportedKills = 0;
+    }
+    // Until every requested restart has gone through, the snapshot still shows the old round.
+    // Requests are counted, not resets: two that land between the same ticks make one reset.
+    if (snapshot.restartRequests < requestedRestarts) {
+        return;
+    }
 
-            spawnClock.restart();
-        }
+    if (snapshot.zombiesKilled != reportedKills) {
+        reportedKills = snapshot.zombiesKilled;
+        checkHighScore(snapshot.zombiesKilled);
     }
 
-    // Update UI elements
-    healthBar.setSize(sf::Vector2f(10 * player->health, 20));
-    zombieKillText.setString("Zombies Killed: " + std::to_string(zombiesKilled));
+    if (snapshot.playerDead && gameState == GameState::PLAYING) {
+        checkHighScore(snapshot.zombiesKilled);
+        gameOverScreen.setFinalScore(snapshot.zombiesKilled, highScores.get());
+        gameState = GameState::GAME_OVER;
+    }
 }
 
 
 
 
 
-void Game::render() {
+void Game::render(const WorldSnapshot& snapshot, float alpha) {
     if (gameState == GameState::MENU) {
         menu.render(window);
     }
@@ -393,47 +569,59 @@ void Game::render() {
         gameOverScreen.render(window);
     }
     else {
-        window.clear(sf::Color::Black);
-        window.setView(cameraView);
-        window.draw(backgroundSprite);
-        player->render(window);
-
-        for (auto& bullet : bullets) bullet.render(window);
-        for (auto& zombieBullet : zombieBullets) zombieBullet.render(window);
-        for (auto& zombie : zombies) zombie.render(window);
-        for (auto& powerUp : powerUps) powerUp.render(window);
-        for (auto& obstacle : obstacles) obstacle.render(window);
-
-        // Draw the Mini-map
-        window.setView(window.getDefaultView());
-        window.setView(miniMapView);
-        window.draw(backgroundSprite);
-
-        // Draw Player as a small dot
-        sf::CircleShape playerDot(50);
-        playerDot.setFillColor(sf::Color::Blue);
-        playerDot.setPosition(player->sprite.getPosition() * 0.08f);
-        window.draw(playerDot);
-
-        // Draw Zombies as red dots
-        for (auto& zombie : zombies) {
-            sf::CircleShape zombieDot(50);
-            zombieDot.setFillColor(sf::Color::Red);
-            zombieDot.setPosition(zombie.sprite.getPosition() * 0.08f);
-            window.draw(zombieDot);
-        }
+        // Paused or between ticks the sim has not moved, so only blend while playing
+        if (isPaused) alpha = 1.0f;
+        if (snapshot.worldVersion != worldVersion) syncWorld(snapshot);
+
+        sf::Vector2f playerPos = snapshot.player.getInterpolatedPosition(alpha);
+        float halfWidth = WINDOW_WIDTH / 2;
+        float halfHeight = WINDOW_HEIGHT / 2;
+
+        const sf::FloatRect& active = snapshot.activeBounds;
+        float minX = active.left + halfWidth, minY = active.top + halfHeight;
+        float maxX = active.left + active.width - halfWidth;
+        float maxY = active.top + active.height - halfHeight;
 
-        // Draw Obstacles as white squares
-        for (auto& obstacle : obstacles) {
-            sf::RectangleShape obstacleDot(sf::Vector2f(6, 6));
-            obstacleDot.setFillColor(sf::Color::White);
-            obstacleDot.setPosition(obstacle.sprite.getPosition() * 0.08f);
-            window.draw(obstacleDot);
+        float cameraX = std::max(minX, std::min(maxX, playerPos.x));
+        float cameraY = std::max(minY, std::min(maxY, playerPos.y));
+
+        cameraView.setCenter(cameraX, cameraY);
+
+        {
+            PROFILE_SCOPE("world");
+            window.clear(sf::Color::Black);
+            window.setView(cameraView);
+            window.draw(backgroundSprite);
+            renderEntities(snapshot, alpha);
         }
 
         window.setView(window.getDefaultView());
-        window.draw(healthBar);
-        window.draw(zombieKillText);
+
+        {
+            // Mini-map refreshes at its own rate; in between it is a single textured quad
+            PROFILE_SCOPE("minimap");
+            minimap.update(playerPos, snapshot.store.zombies);
+            minimap.render(window);
+        }
+
+        {
+            PROFILE_SCOPE("hud");
+            // Cheap when nothing changed: the HUD only re-lays out a widget whose value moved
+            hud->setHealth(snapshot.player.health);
+            hud->setKills(snapshot.zombiesKilled);
+            hud->render(window);
+
+            if (showRenderStats) {
+                const SpriteBatch::Stats& stats = spriteBatch.getStats();
+                renderStatsText.setString("sprites: " + std::to_string(stats.sprites) +
+                    "  culled: " + std::to_string(stats.culled) +
+                    "  draw calls: " + std::to_string(stats.drawCalls) +
+                    "  vertices: " + std::to_string(stats.vertices) +
+                    "  sim: " + std::to_string(snapshot.tickMs) + " ms/tick" +
+                    (simThread.isThreaded() ? " (threaded)" : ""));
+                window.draw(renderStatsText);
+            }
+        }
 
         if (isPaused) {
             sf::Vector2i mousePos = sf::Mouse::getPosition(window);
@@ -459,26 +647,86 @@ void Game::render() {
             window.draw(exitText);
         }
 
+        if (showProfiler) {
+            PROFILE_SCOPE("profiler_overlay");
+            profilerOverlay->render(window, Profiler::get());
+        }
 
+        // Only the buffer swap: FrameScheduler paces after the frame has ended, outside every scope
+        PROFILE_SCOPE("present");
         window.display();
     }
-
-
 }
-int Game::loadHighScore() {
-    std::ifstream file("highscore.txt");
-    int score = 0;
-    if (file.is_open()) {
-        file >> score;
-        file.close();
-    }
-    return score;
+
+void Game::renderLoading() {
+    float progress = assets.getProgress();
+    loadingBar.setSize(sf::Vector2f(loadingBarBack.getSize().x * progress, loadingBarBack.getSize().y));
+    loadingText.setString("Loading... " + std::to_string(static_cast<int>(progress * 100)) + "%");
+
+    window.clear(sf::Color::Black);
+    window.setView(window.getDefaultView());
+    window.draw(loadingText);
+    window.draw(loadingBarBack);
+    window.draw(loadingBar);
+    window.display();
 }
 
-void Game::saveHighScore() {
-    std::ofstream file("highscore.txt");
-    if (file.is_open()) {
-        file << highScore;
-        file.close();
+void Game::renderEntities(const WorldSnapshot& snapshot, float alpha) {
+    // Everything in the world layer goes through one batch: one draw call per texture. Only
+    // what intersects the camera rectangle is turned into sprites.
+    sf::FloatRect visible(cameraView.getCenter() - cameraView.getSize() / 2.0f, cameraView.getSize());
+    spriteBatch.begin(visible);
+
+    const Player& player = snapshot.player;
+    sf::Sprite& playerSprite = entitySprites[static_cast<int>(TextureId::Player)];
+    playerSprite.setPosition(player.getInterpolatedPosition(alpha));
+    playerSprite.setRotation(lerpAngle(player.previousRotation, player.rotation, alpha));
+    spriteBatch.draw(playerSprite);
+
+    auto drawProjectiles = [&](const ProjectilePool& projectiles) {
+        for (size_t i = 0; i < projectiles.size(); ++i) {
+            sf::Vector2f position = projectiles.previousPosition[i] + (projectiles.position[i] - projectiles.previousPosition[i]) * alpha;
+            if (!spriteBatch.isVisible(sf::FloatRect(position, projectiles.extent))) continue;
+
+            sf::Sprite& sprite = entitySprites[static_cast<int>(projectiles.texture[i])];
+            sprite.setPosition(position);
+            spriteBatch.draw(sprite);
+        }
+    };
+
+    drawProjectiles(snapshot.store.bullets);
+    drawProjectiles(snapshot.store.zombieBullets);
+
+    // Zombies turn about their top-left corner, so any rotation stays within one diagonal of it
+    const ZombieArchetype& zombies = snapshot.store.zombies;
+    float reach = std::sqrt(zombies.extent.x * zombies.extent.x + zombies.extent.y * zombies.extent.y);
+    for (size_t i = 0; i < zombies.size(); ++i) {
+        sf::Vector2f position = zombies.previousPosition[i] + (zombies.position[i] - zombies.previousPosition[i]) * alpha;
+        if (!spriteBatch.isVisible(sf::FloatRect(position.x - reach, position.y - reach, 2 * reach, 2 * reach))) continue;
+
+        sf::Sprite& sprite = entitySprites[static_cast<int>(zombies.texture[i])];
+        sprite.setPosition(position);
+        sprite.setRotation(lerpAngle(zombies.previousRotation[i], zombies.rotation[i], alpha));
+        spriteBatch.draw(sprite);
+    }
+
+    const PowerUpArchetype& powerUps = snapshot.store.powerUps;
+    for (size_t i = 0; i < powerUps.size(); ++i) {
+        if (!spriteBatch.isVisible(sf::FloatRect(powerUps.position[i], powerUps.extent))) continue;
+
+        sf::Sprite& sprite = entitySprites[static_cast<int>(powerUps.texture[i])];
+        sprite.setPosition(powerUps.position[i]);
+        spriteBatch.draw(sprite);
     }
-};
\ No newline at end of file
+
+    // The obstacle sprites are built in the same order as the tree, so it answers which ones
+    // are on screen, in index order
+    obstacleTree.query(visible, visibleObstacles);
+    for (int index : visibleObstacles)
+        spriteBatch.draw(obstacles[index].sprite);
+    spriteBatch.addCulled(static_cast<unsigned int>(obstacles.size() - visibleObstacles.size()));
+
+    spriteBatch.end(window);
+    TRACE_COUNTER("sprites_submitted", spriteBatch.getStats().sprites);
+    TRACE_COUNTER("sprites_culled", spriteBatch.getStats().culled);
+}
@@ -7,45 +7,72 @@
 #include <iostream>
 #include <fstream>
 #include <ctime>
+#include <algorithm>
 #include "Constants.hpp"
-#include "Player.hpp"
-#include "Bullet.hpp"
 #include "Obstacle.hpp"
-#include "ZombieBullet.hpp"
-#include "Zombie.hpp"
-#include "PowerUp.hpp"
+#include "Simulation.hpp"
+#include "ThreadPool.hpp"
+#include "AssetLoader.hpp"
+#include "FrameScheduler.hpp"
+#include "ResourceCache.hpp"
+#include "SimulationThread.hpp"
+#include "InputSource.hpp"
+#include "KeyboardInput.hpp"
+#include "InputRecorder.hpp"
+#include "ReplayInput.hpp"
+#include "HighScoreStore.hpp"
+#include "Hud.hpp"
+#include "Minimap.hpp"
+#include "SpriteBatch.hpp"
+#include "Profiler.hpp"
+#include "ProfilerOverlay.hpp"
+#include "TextureAtlas.hpp"
 #include "Menu.hpp"
 #include "GameOverScreen.hpp"
 
 class Game {
 private:
+    sf::Clock startupClock;   // first member, so it starts before anything else is constructed
     sf::RenderWindow window;
-    sf::Texture playerTexture, bulletTexture, zombieTexture, zombieBulletTexture;
-    Player* player;
-    std::vector<Bullet> bullets;
+    ResourceCache resources;   // before everything that holds a handle into it
+    HighScoreStore highScores;
+    TextureAtlas atlas;
+    ThreadPool threads;
+    Simulation sim;
+    KeyboardInput keyboardInput;
+    InputSource* input;
+    FrameScheduler scheduler;
+    unsigned int frameRateLimit = FRAME_RATE_LIMIT;
+    bool hasFocus = true;
+    InputRecording recording;
+    std::string recordingPath;
+    std::unique_ptr<InputRecorder> recorder;
+    std::unique_ptr<ReplayInput> replay;
+    bool fastReplay = false;
+    sf::Clock replayClock;
+    sf::Sprite entitySprites[static_cast<int>(TextureId::Count)];
+    SpriteBatch spriteBatch;
+    StaticCollisionWorld obstacleTree;   // render-side copy of the snapshot's obstacles, for culling
+    std::vector<int> visibleObstacles;
+    bool showRenderStats = false;
+    sf::Text renderStatsText;
+    bool showProfiler = false;
+    std::unique_ptr<ProfilerOverlay> profilerOverlay;
+    std::unique_ptr<Hud> hud;
     std::vector<Obstacle> obstacles;
-    std::vector<ZombieBullet> zombieBullets;
-    std::vector<Zombie> zombies;
-    sf::Font font;
-    sf::Text zombieKillText;
+    std::shared_ptr<sf::Font> font;
     sf::Music backgroundMusic;
-    sf::RectangleShape healthBar;
-    int zombiesKilled = 0;
     int highScore = 0;
-    sf::Clock spawnClock;
-    float zombieSpawnInterval = 3.0f;
-    sf::Texture powerUpHealthTexture, powerUpSpeedTexture, powerUpDamageTexture;
-    std::vector<PowerUp> powerUps;
-    sf::Clock powerUpSpawnClock;
-    sf::Texture backgroundTexture;
+    int reportedKills = 0;
+    int requestedRestarts = 0;   // restarts asked of the simulation thread
+    int seenRestarts = 0;        // resets it has reported back, requested or replayed
+    std::shared_ptr<sf::Texture> backgroundTexture;
     sf::Sprite backgroundSprite;
-    sf::Texture blockTexture;
-    sf::Texture waterTexture;
-    sf::Texture pillarTexture;
-    sf::Texture vaseTexture;
     sf::View cameraView;
-    sf::View miniMapView;
+    Minimap minimap;
+    unsigned int worldVersion = 0;   // snapshot world version the sprites and minimap were built for
     GameState gameState;
+    GameState previousState;
     Menu menu;
     bool isPaused = false;
     sf::Text pauseText;
@@ -54,21 +81,47 @@ private:
     sf::Text resumeText;
     sf::Text exitText;
     GameOverScreen gameOverScreen;
+    float simTickRate = SIM_TICK_RATE;
+    sf::Text loadingText;
+    sf::RectangleShape loadingBarBack;
+    sf::RectangleShape loadingBar;
+    bool atlasComplete = false;
+    bool firstFrameShown = false;
+    // Ticks 'sim' from start to the end of run(); after the input sources, which it samples
+    SimulationThread simThread;
+    // Declared last so it is destroyed first: its workers write into the members above
+    AssetLoader assets;
 
 public:
-    Game();
-    ~Game();
+    // Worlds larger than WORLD_SIZE stream in chunks; obstacles are generated per chunk
+    explicit Game(unsigned int seed, float worldSize = WORLD_SIZE, int obstaclesPerChunk = 0);
     void run();
-    void spawnPowerUp();
-    void checkHighScore();
-    void checkPowerUpCollisions();
+    void setSimulationRate(float ticksPerSecond);
+    void setFrameRateLimit(unsigned int framesPerSecond);
+    void setInputSource(InputSource* source);
+    void setTraceBudget(float milliseconds);
+    // Both must be called before run(); a replay needs a Game built with the recording's seed
+    void recordTo(const std::string& path);
+    void playRecording(const InputRecording& recorded, bool asFastAsPossible);
+    void queueAssets();
+    void updateLoading();
+    void finishLoading();
+    void startSimulation();
+    void syncWorld(const WorldSnapshot& snapshot);
+    void onStateChanged();
+    void finishReplay(const WorldSnapshot& snapshot);
+    void renderLoading();
+    void checkHighScore(int kills);
     void restartGame();
-    void handleEvents();
-    void checkCollisions();
-    void update();
-    void render();
-    int loadHighScore();
-    void saveHighScore();
+    bool isIdle() const;
+    void applyFrameRate();
+    // 'first' is an event already taken off the queue, e.g. the one an idle wait woke up for
+    void handleEvents(const sf::Event* first = nullptr);
+    void handleEvent(const sf::Event& event);
+    // Game state follows the simulation through its snapshots: deaths, kills, restarts
+    void update(const WorldSnapshot& snapshot);
+    void render(const WorldSnapshot& snapshot, float alpha);
+    void renderEntities(const WorldSnapshot& snapshot, float alpha);
 };
 
 #endif // GAME_HPP
@@ -1,31 +1,31 @@
 #include "GameOverScreen.hpp"
 
-GameOverScreen::GameOverScreen() : isNewHighScore(false) {
-    font.loadFromFile("arial.ttf");
+GameOverScreen::GameOverScreen(ResourceCache& resources) : isNewHighScore(false) {
+    font = resources.getFont("arial.ttf");
 
-    gameOverText.setFont(font);
+    gameOverText.setFont(*font);
     gameOverText.setString("Game Over!");
     gameOverText.setCharacterSize(60);
     gameOverText.setFillColor(sf::Color::Red);
     centerTextGameOver(gameOverText, WINDOW_WIDTH, WINDOW_HEIGHT, 0, -200);
 
-    scoreText.setFont(font);
+    scoreText.setFont(*font);
     scoreText.setCharacterSize(40);
     scoreText.setFillColor(sf::Color::White);
     centerTextGameOver(scoreText, WINDOW_WIDTH, WINDOW_HEIGHT, -100, -100);
 
-    highScoreText.setFont(font);
+    highScoreText.setFont(*font);
     highScoreText.setCharacterSize(35);
     highScoreText.setFillColor(sf::Color::Yellow);
     centerTextGameOver(highScoreText, WINDOW_WIDTH, WINDOW_HEIGHT, -100, -50);
 
-    restartText.setFont(font);
+    restartText.setFont(*font);
     restartText.setString("Press R to Restart");
     restartText.setCharacterSize(30);
     restartText.setFillColor(sf::Color::White);
     centerTextGameOver(restartText, WINDOW_WIDTH, WINDOW_HEIGHT, 0, 50);
 
-    exitText.setFont(font);
+    exitText.setFont(*font);
     exitText.setString("Press Esc to Exit");
     exitText.setCharacterSize(30);
     exitText.setFillColor(sf::Color::White);
@@ -3,10 +3,11 @@
 
 #include <SFML/Graphics.hpp>
 #include "Constants.hpp"
+#include "ResourceCache.hpp"
 
 class GameOverScreen {
 private:
-    sf::Font font;
+    std::shared_ptr<sf::Font> font;
     sf::Text gameOverText;
     sf::Text scoreText;
     sf::Text highScoreText;
@@ -18,7 +19,7 @@ public:
     sf::Text restartText;
     sf::Text exitText;
 
-    GameOverScreen();
+    explicit GameOverScreen(ResourceCache& resources);
 
     void setFinalScore(int score, int savedHighScore);
     void render(sf::RenderWindow& window);
@@ -1,4 +1,5 @@
 #include "Helper.hpp"
+#include <cmath>
 
 void centerTextMenu(sf::Text& text, float windowWidth, float windowHeight, float yOffset) {
     sf::FloatRect textBounds = text.getLocalBounds();
@@ -11,3 +12,70 @@ void centerTextGameOver(sf::Text& text, float windowWidth, float windowHeight, f
     text.setOrigin(textBounds.width / 2.0f, textBounds.height / 2.0f);
     text.setPosition((windowWidth / 2.0f) + xOffset, (windowHeight / 2.0f) + yOffset);
 }
+
+float lerpAngle(float from, float to, float alpha) {
+    // Take the short way round so 359 -> 1 does not spin through 180
+    float difference = std::fmod(to - from + 540.0f, 360.0f) - 180.0f;
+    return from + difference * alpha;
+}
+
+size_t formatInt(int value, char* buffer, size_t capacity) {
+    // Digits come out backwards; unsigned so INT_MIN negates cleanly
+    char digits[12];
+    size_t count = 0;
+    unsigned int magnitude = value < 0 ? 0u - static_cast<unsigned int>(value) : static_cast<unsigned int>(value);
+    do {
+        digits[count++] = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude > 0);
+    if (value < 0) digits[count++] = '-';
+
+    if (count + 1 > capacity) return 0;
+    for (size_t i = 0; i < count; ++i)
+        buffer[i] = digits[count - 1 - i];
+    buffer[count] = '\0';
+    return count;
+}
+
+void appendGlyphQuad(std::vector<sf::Vertex>& vertices, float left, float top, float width, float height, sf::Color color) {
+    // Any point inside the 2x2 white square sf::Font reserves at the top-left of each page
+    const sf::Vector2f whiteTexel(1.0f, 1.0f);
+    sf::Vertex topLeft(sf::Vector2f(left, top), color, whiteTexel);
+    sf::Vertex topRight(sf::Vector2f(left + width, top), color, whiteTexel);
+    sf::Vertex bottomLeft(sf::Vector2f(left, top + height), color, whiteTexel);
+    sf::Vertex bottomRight(sf::Vector2f(left + width, top + height), color, whiteTexel);
+
+    vertices.push_back(topLeft);
+    vertices.push_back(bottomLeft);
+    vertices.push_back(topRight);
+    vertices.push_back(topRight);
+    vertices.push_back(bottomLeft);
+    vertices.push_back(bottomRight);
+}
+
+float appendGlyphText(std::vector<sf::Vertex>& vertices, const sf::Font& font, unsigned int characterSize,
+    const char* text, float left, float top, sf::Color color) {
+    // Same glyph placement as sf::Text, minus kerning and styles
+    float x = left;
+    float baseline = top + characterSize;
+    for (const char* c = text; *c; ++c) {
+        const sf::Glyph& glyph = font.getGlyph(static_cast<unsigned char>(*c), characterSize, false);
+        const sf::FloatRect& bounds = glyph.bounds;
+        const sf::IntRect& rect = glyph.textureRect;
+
+        float x0 = x + bounds.left, y0 = baseline + bounds.top;
+        float x1 = x0 + bounds.width, y1 = y0 + bounds.height;
+        float u0 = static_cast<float>(rect.left), v0 = static_cast<float>(rect.top);
+        float u1 = u0 + rect.width, v1 = v0 + rect.height;
+
+        vertices.push_back(sf::Vertex(sf::Vector2f(x0, y0), color, sf::Vector2f(u0, v0)));
+        vertices.push_back(sf::Vertex(sf::Vector2f(x0, y1), color, sf::Vector2f(u0, v1)));
+        vertices.push_back(sf::Vertex(sf::Vector2f(x1, y0), color, sf::Vector2f(u1, v0)));
+        vertices.push_back(sf::Vertex(sf::Vector2f(x1, y0), color, sf::Vector2f(u1, v0)));
+        vertices.push_back(sf::Vertex(sf::Vector2f(x0, y1), color, sf::Vector2f(u0, v1)));
+        vertices.push_back(sf::Vertex(sf::Vector2f(x1, y1), color, sf::Vector2f(u1, v1)));
+
+        x += glyph.advance;
+    }
+    return x;
+}
@@ -2,8 +2,19 @@
 #define HELPER_HPP
 
 #include <SFML/Graphics.hpp>
+#include <vector>
 
 void centerTextMenu(sf::Text& text, float windowWidth, float windowHeight, float yOffset = 0);
 void centerTextGameOver(sf::Text& text, float windowWidth, float windowHeight, float xOffset = 0, float yOffset = 0);
+float lerpAngle(float from, float to, float alpha);
+// Writes 'value' in decimal plus a terminating zero; returns its length, or 0 if it does not fit
+size_t formatInt(int value, char* buffer, size_t capacity);
+
+// Triangle-list meshes on a font's glyph page, drawn with font.getTexture(characterSize): solid
+// quads sample the white square the page reserves, so fills and text share one draw call
+void appendGlyphQuad(std::vector<sf::Vertex>& vertices, float left, float top, float width, float height, sf::Color color);
+// Returns the pen position after the last glyph
+float appendGlyphText(std::vector<sf::Vertex>& vertices, const sf::Font& font, unsigned int characterSize,
+    const char* text, float left, float top, sf::Color color);
 
 #endif // HELPER_HPP
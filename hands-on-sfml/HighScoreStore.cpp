@@ -0,0 +1,97 @@
+#include "HighScoreStore.hpp"
+#include "TraceRecorder.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+HighScoreStore::HighScoreStore(const std::string& path) : path(path), best(load()) {
+    writer = std::thread(&HighScoreStore::writerLoop, this);
+}
+
+HighScoreStore::~HighScoreStore() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    writer.join();
+}
+
+int HighScoreStore::load() const {
+    std::ifstream file(path);
+    int score = 0;
+    if (file.is_open()) {
+        file >> score;
+        file.close();
+    }
+    return score;
+}
+
+bool HighScoreStore::submit(int score) {
+    int current = best.load();
+    while (score > current) {
+        if (best.compare_exchange_weak(current, score)) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                pendingScore = std::max(pendingScore, score);
+                hasPending = true;
+            }
+            wake.notify_one();
+            return true;
+        }
+    }
+    return false;
+}
+
+void HighScoreStore::flush() {
+    std::unique_lock<std::mutex> lock(mutex);
+    written.wait(lock, [this] { return !hasPending && !writing; });
+}
+
+bool HighScoreStore::writeFile(int score) const {
+    std::string tempPath = path + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::trunc);
+        if (!file.is_open()) return false;
+        file << score;
+        file.flush();
+        if (!file) return false;
+    }
+
+#ifdef _WIN32
+    // std::rename refuses to replace an existing file on Windows
+    return MoveFileExA(tempPath.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    return std::rename(tempPath.c_str(), path.c_str()) == 0;
+#endif
+}
+
+void HighScoreStore::writerLoop() {
+    TRACE_THREAD_NAME("high score writer");
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wake.wait(lock, [this] { return hasPending || stopping; });
+        if (!hasPending && stopping) break;
+
+        int score = pendingScore;
+        hasPending = false;
+        writing = true;
+
+        lock.unlock();
+        TRACE_SCOPE("write_high_score");
+        if (!writeFile(score)) {
+            std::cerr << "Error saving high score to " << path << "\n";
+        }
+        lock.lock();
+
+        writing = false;
+        written.notify_all();
+    }
+}
@@ -0,0 +1,45 @@
+#ifndef HIGHSCORESTORE_HPP
+#define HIGHSCORESTORE_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// Keeps the high score in memory and persists it from a background thread.
+// The file is read once on construction; submit() never touches the disk. Scores submitted
+// while a write is in flight are coalesced, and only the latest reaches the file. Writes go
+// to a temp file that is then renamed over the real one, so a crash never leaves it half
+// written. The destructor flushes anything still pending.
+class HighScoreStore {
+public:
+    explicit HighScoreStore(const std::string& path);
+    ~HighScoreStore();
+
+    HighScoreStore(const HighScoreStore&) = delete;
+    HighScoreStore& operator=(const HighScoreStore&) = delete;
+
+    int get() const { return best.load(); }
+    bool submit(int score);
+    void flush();
+
+private:
+    std::string path;
+    std::atomic<int> best;
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable written;
+    int pendingScore = 0;
+    bool hasPending = false;
+    bool writing = false;
+    bool stopping = false;
+    std::thread writer;
+
+    int load() const;
+    bool writeFile(int score) const;
+    void writerLoop();
+};
+
+#endif // HIGHSCORESTORE_HPP
@@ -0,0 +1,54 @@
+#include "Hud.hpp"
+#include "Constants.hpp"
+#include "Helper.hpp"
+#include <algorithm>
+
+namespace {
+    const unsigned int CHARACTER_SIZE = 20;
+    const char* const KILLS_LABEL = "Zombies Killed: ";
+    const sf::Vector2f BAR_POSITION(10, WINDOW_HEIGHT - 30);
+    const sf::Vector2f KILLS_POSITION(10, WINDOW_HEIGHT - 60);
+    const float BAR_HEIGHT = 20.0f;
+    const float BAR_WIDTH_PER_HEALTH = 10.0f;
+    const size_t MAX_TEXT_LENGTH = 64;
+}
+
+Hud::Hud(const sf::Font& font) : font(font), health(PLAYER_MAX_HEALTH), kills(0) {
+    // Looking a glyph up the first time inserts it into the font's cache; do that now, not mid-game
+    for (const char* c = KILLS_LABEL; *c; ++c)
+        font.getGlyph(static_cast<unsigned char>(*c), CHARACTER_SIZE, false);
+    for (const char* c = "-0123456789"; *c; ++c)
+        font.getGlyph(static_cast<unsigned char>(*c), CHARACTER_SIZE, false);
+
+    // Reserved once, so re-stamping the digits never reallocates
+    vertices.reserve(6 * MAX_TEXT_LENGTH);
+    appendGlyphQuad(vertices, BAR_POSITION.x, BAR_POSITION.y, health * BAR_WIDTH_PER_HEALTH, BAR_HEIGHT, sf::Color::White);
+    labelRight = appendGlyphText(vertices, font, CHARACTER_SIZE, KILLS_LABEL, KILLS_POSITION.x, KILLS_POSITION.y, sf::Color::White);
+    labelEnd = vertices.size();
+    appendGlyphText(vertices, font, CHARACTER_SIZE, "0", labelRight, KILLS_POSITION.y, sf::Color::White);
+}
+
+void Hud::setHealth(int value) {
+    if (value == health) return;
+    health = value;
+
+    // Only the right edge moves: vertices 2, 3 and 5 of the bar
+    float right = BAR_POSITION.x + std::max(0, health) * BAR_WIDTH_PER_HEALTH;
+    vertices[2].position.x = right;
+    vertices[3].position.x = right;
+    vertices[5].position.x = right;
+}
+
+void Hud::setKills(int value) {
+    if (value == kills) return;
+    kills = value;
+
+    char digits[12];
+    formatInt(kills, digits, sizeof(digits));
+    vertices.resize(labelEnd);
+    appendGlyphText(vertices, font, CHARACTER_SIZE, digits, labelRight, KILLS_POSITION.y, sf::Color::White);
+}
+
+void Hud::render(sf::RenderTarget& target) {
+    target.draw(vertices.data(), vertices.size(), sf::Triangles, sf::RenderStates(&font.getTexture(CHARACTER_SIZE)));
+}
@@ -0,0 +1,30 @@
+#ifndef HUD_HPP
+#define HUD_HPP
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+// In-game health bar and kill counter. Each widget is bound to one value and only laid out
+// again when that value changes: the bar moves its right edge, the counter re-stamps its
+// digits. Both live in one vertex list sampling the font's glyph page (the white square at
+// its origin fills the bar), so the HUD is a single draw call and an unchanged frame does no
+// layout and no allocation.
+class Hud {
+public:
+    explicit Hud(const sf::Font& font);
+
+    void setHealth(int health);
+    void setKills(int kills);
+    void render(sf::RenderTarget& target);
+
+private:
+    const sf::Font& font;
+    int health;
+    int kills;
+    // The bar's six vertices come first, then the counter's label and digits
+    std::vector<sf::Vertex> vertices;
+    size_t labelEnd = 0;
+    float labelRight = 0.0f;
+};
+
+#endif // HUD_HPP
@@ -0,0 +1,8 @@
+#include "InputRecorder.hpp"
+
+InputState InputRecorder::sample() {
+    InputState input = source.sample();
+    recording.ticks.push_back(InputRecording::pack(input) | (pendingRestart ? InputRecording::RESTART : 0));
+    pendingRestart = false;
+    return input;
+}
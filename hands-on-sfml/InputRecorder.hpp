@@ -0,0 +1,23 @@
+#ifndef INPUTRECORDER_HPP
+#define INPUTRECORDER_HPP
+
+#include "InputRecording.hpp"
+#include "InputSource.hpp"
+
+// Passes another source's input through unchanged and appends every tick to a recording
+class InputRecorder : public InputSource {
+public:
+    InputRecorder(InputSource& source, InputRecording& recording) : source(source), recording(recording) {}
+
+    InputState sample() override;
+
+    // The simulation is about to be reset; flagged on the next recorded tick
+    void markRestart() { pendingRestart = true; }
+
+private:
+    InputSource& source;
+    InputRecording& recording;
+    bool pendingRestart = false;
+};
+
+#endif // INPUTRECORDER_HPP
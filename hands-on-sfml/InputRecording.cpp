@@ -0,0 +1,115 @@
+#include "InputRecording.hpp"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace {
+    const char MAGIC[4] = { 'R', 'A', 'I', 'R' };
+    const uint16_t VERSION = 2;   // 2 added the world size and obstacles per chunk
+
+    // Little-endian regardless of the host, so recordings move between machines
+    void writeBytes(std::ostream& out, uint64_t value, int bytes) {
+        for (int i = 0; i < bytes; ++i)
+            out.put(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+
+    uint64_t readBytes(std::istream& in, int bytes) {
+        uint64_t value = 0;
+        for (int i = 0; i < bytes; ++i)
+            value |= static_cast<uint64_t>(static_cast<unsigned char>(in.get())) << (8 * i);
+        return value;
+    }
+
+    uint32_t floatBits(float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    float bitsFloat(uint32_t bits) {
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+}
+
+uint8_t InputRecording::pack(const InputState& input) {
+    return static_cast<uint8_t>(
+        (input.up ? 0x01 : 0) | (input.down ? 0x02 : 0) | (input.left ? 0x04 : 0) | (input.right ? 0x08 : 0) |
+        (input.turnLeft ? 0x10 : 0) | (input.turnRight ? 0x20 : 0) | (input.fire ? 0x40 : 0));
+}
+
+InputState InputRecording::unpack(uint8_t tick) {
+    InputState input;
+    input.up = (tick & 0x01) != 0;
+    input.down = (tick & 0x02) != 0;
+    input.left = (tick & 0x04) != 0;
+    input.right = (tick & 0x08) != 0;
+    input.turnLeft = (tick & 0x10) != 0;
+    input.turnRight = (tick & 0x20) != 0;
+    input.fire = (tick & 0x40) != 0;
+    return input;
+}
+
+bool InputRecording::save(const std::string& path) const {
+    std::ofstream out(path, std::ios::binary);
+    if (!out.is_open()) {
+        std::cerr << "Error writing recording " << path << "!\n";
+        return false;
+    }
+
+    out.write(MAGIC, sizeof(MAGIC));
+    writeBytes(out, VERSION, 2);
+    writeBytes(out, seed, 4);
+    writeBytes(out, floatBits(tickRate), 4);
+    writeBytes(out, floatBits(zombieSpawnInterval), 4);
+    writeBytes(out, floatBits(worldSize), 4);
+    writeBytes(out, static_cast<uint32_t>(obstaclesPerChunk), 4);
+    writeBytes(out, finalStateHash, 8);
+    writeBytes(out, ticks.size(), 4);
+
+    // Runs of (tick byte, repeat count up to 65535)
+    for (size_t i = 0; i < ticks.size();) {
+        size_t run = 1;
+        while (i + run < ticks.size() && ticks[i + run] == ticks[i] && run < 0xFFFF) run++;
+        writeBytes(out, ticks[i], 1);
+        writeBytes(out, run, 2);
+        i += run;
+    }
+    return static_cast<bool>(out);
+}
+
+bool InputRecording::load(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    char magic[4];
+    if (!in.is_open() || !in.read(magic, sizeof(magic)) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0) {
+        std::cerr << "Error reading recording " << path << "!\n";
+        return false;
+    }
+    if (readBytes(in, 2) != VERSION) {
+        std::cerr << "Error: " << path << " was recorded by an incompatible version!\n";
+        return false;
+    }
+
+    seed = static_cast<uint32_t>(readBytes(in, 4));
+    tickRate = bitsFloat(static_cast<uint32_t>(readBytes(in, 4)));
+    zombieSpawnInterval = bitsFloat(static_cast<uint32_t>(readBytes(in, 4)));
+    worldSize = bitsFloat(static_cast<uint32_t>(readBytes(in, 4)));
+    obstaclesPerChunk = static_cast<int32_t>(readBytes(in, 4));
+    finalStateHash = readBytes(in, 8);
+    size_t tickCount = static_cast<size_t>(readBytes(in, 4));
+
+    ticks.clear();
+    ticks.reserve(tickCount);
+    while (ticks.size() < tickCount && in) {
+        uint8_t tick = static_cast<uint8_t>(readBytes(in, 1));
+        size_t run = static_cast<size_t>(readBytes(in, 2));
+        ticks.insert(ticks.end(), run, tick);
+    }
+
+    if (!in || ticks.size() != tickCount) {
+        std::cerr << "Error: recording " << path << " is truncated!\n";
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,31 @@
+#ifndef INPUTRECORDING_HPP
+#define INPUTRECORDING_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Constants.hpp"
+#include "InputSource.hpp"
+
+// Everything needed to re-run a session tick for tick: the simulation seed and settings, and
+// one byte of input per simulation tick. The top bit of a tick marks a restart (sim.reset())
+// just before it. On disk the ticks are run-length encoded, so held keys cost almost nothing.
+struct InputRecording {
+    static const uint8_t RESTART = 0x80;
+
+    uint32_t seed = 0;
+    float tickRate = SIM_TICK_RATE;
+    float zombieSpawnInterval = 3.0f;
+    float worldSize = WORLD_SIZE;
+    int32_t obstaclesPerChunk = 0;
+    uint64_t finalStateHash = 0;   // Simulation::hashState() after the last tick
+    std::vector<uint8_t> ticks;
+
+    static uint8_t pack(const InputState& input);
+    static InputState unpack(uint8_t tick);
+
+    bool save(const std::string& path) const;
+    bool load(const std::string& path);
+};
+
+#endif // INPUTRECORDING_HPP
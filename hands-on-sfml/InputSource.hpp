@@ -0,0 +1,24 @@
+#ifndef INPUTSOURCE_HPP
+#define INPUTSOURCE_HPP
+
+// Player intent for one simulation tick. The simulation only ever sees this,
+// never the keyboard, so it can be driven by a script or run without a window.
+struct InputState {
+    bool up = false;
+    bool down = false;
+    bool left = false;
+    bool right = false;
+    bool turnLeft = false;
+    bool turnRight = false;
+    bool fire = false;
+};
+
+class InputSource {
+public:
+    virtual ~InputSource() = default;
+
+    // Called once per simulation tick
+    virtual InputState sample() = 0;
+};
+
+#endif // INPUTSOURCE_HPP
@@ -0,0 +1,14 @@
+#include "KeyboardInput.hpp"
+#include <SFML/Window/Keyboard.hpp>
+
+InputState KeyboardInput::sample() {
+    InputState input;
+    input.up = sf::Keyboard::isKeyPressed(sf::Keyboard::W);
+    input.down = sf::Keyboard::isKeyPressed(sf::Keyboard::S);
+    input.left = sf::Keyboard::isKeyPressed(sf::Keyboard::A);
+    input.right = sf::Keyboard::isKeyPressed(sf::Keyboard::D);
+    input.turnLeft = sf::Keyboard::isKeyPressed(sf::Keyboard::Left);
+    input.turnRight = sf::Keyboard::isKeyPressed(sf::Keyboard::Right);
+    input.fire = sf::Keyboard::isKeyPressed(sf::Keyboard::Space);
+    return input;
+}
@@ -0,0 +1,12 @@
+#ifndef KEYBOARDINPUT_HPP
+#define KEYBOARDINPUT_HPP
+
+#include "InputSource.hpp"
+
+// Live input: W/A/S/D to move, Left/Right to turn, Space to fire
+class KeyboardInput : public InputSource {
+public:
+    InputState sample() override;
+};
+
+#endif // KEYBOARDINPUT_HPP
@@ -1,26 +1,52 @@
 ﻿#include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
 #include "Constants.hpp"
-#include "Entity.hpp"
 #include "Obstacle.hpp"
 #include "Player.hpp"
 #include "PowerUp.hpp"
-#include "Bullet.hpp"
-#include "ZombieBullet.hpp"
-#include "Zombie.hpp"
+#include "EntityStore.hpp"
 #include "Menu.hpp"
 #include "GameOverScreen.hpp"
 #include "Game.hpp"
 #include "Helper.hpp"
 #include <vector>
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 #include <ctime>
 #include <iostream>
 #include <fstream> 
+#include <string>
 
-int main() {
-    Game game;
+// red-alert [--world <size>] [--record <file>] [--replay <file> [--fast]]
+//   --world   side of a larger, generated world that streams in around the player
+//   --record  saves the seed and every tick's input when the game exits
+//   --replay  plays a recording back; --fast runs it as quickly as possible
+int main(int argc, char* argv[]) {
+    std::string recordPath, replayPath;
+    bool fast = false;
+    float worldSize = WORLD_SIZE;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--world" && i + 1 < argc) worldSize = std::max(WORLD_SIZE, static_cast<float>(std::atof(argv[++i])));
+        else if (arg == "--record" && i + 1 < argc) recordPath = argv[++i];
+        else if (arg == "--replay" && i + 1 < argc) replayPath = argv[++i];
+        else if (arg == "--fast") fast = true;
+    }
+
+    unsigned int seed = static_cast<unsigned>(time(0));
+    int obstaclesPerChunk = worldSize > WORLD_SIZE ? GENERATED_OBSTACLES_PER_CHUNK : 0;
+    InputRecording recording;
+    if (!replayPath.empty()) {
+        if (!recording.load(replayPath)) return 1;
+        seed = recording.seed;
+        worldSize = recording.worldSize;
+        obstaclesPerChunk = recording.obstaclesPerChunk;
+    }
+
+    Game game(seed, worldSize, obstaclesPerChunk);
+    if (!replayPath.empty()) game.playRecording(recording, fast);
+    else if (!recordPath.empty()) game.recordTo(recordPath);
     game.run();
     return 0;
 }
@@ -1,29 +1,27 @@
 #include "Menu.hpp"
 
-Menu::Menu(int highScore) : soundOn(true), highScore(highScore) {
-    font.loadFromFile("arial.ttf");
-    backgroundTexture.loadFromFile("assets/menu_background.jpg");
-    backgroundSprite.setTexture(backgroundTexture);
+Menu::Menu(ResourceCache& resources, int highScore) : resources(resources), soundOn(true), highScore(highScore) {
+    font = resources.getFont("arial.ttf");
 
-    title.setFont(font);
+    title.setFont(*font);
     title.setString("Red Alert");
     title.setCharacterSize(60);
     title.setFillColor(sf::Color::Red);
     centerTextMenu(title, WINDOW_WIDTH, WINDOW_HEIGHT, -150);
 
-    startText.setFont(font);
+    startText.setFont(*font);
     startText.setString("Start Game");
     startText.setCharacterSize(30);
     startText.setFillColor(sf::Color::Black);
     centerTextMenu(startText, WINDOW_WIDTH, WINDOW_HEIGHT, -50);
 
-    soundText.setFont(font);
+    soundText.setFont(*font);
     soundText.setString("Sound: On");
     soundText.setCharacterSize(30);
     soundText.setFillColor(sf::Color::Black);
     centerTextMenu(soundText, WINDOW_WIDTH, WINDOW_HEIGHT, +20);
 
-    highScoreText.setFont(font);
+    highScoreText.setFont(*font);
     highScoreText.setString("High Score: " + std::to_string(highScore));
     highScoreText.setCharacterSize(30);
     highScoreText.setFillColor(sf::Color::Black);
@@ -36,6 +34,21 @@ void Menu::centerTextMenu(sf::Text& text, int windowWidth, int windowHeight, int
     text.setPosition(windowWidth / 2, windowHeight / 2 + yOffset);
 }
 
+void Menu::loadBackground(AssetLoader* loader) {
+    backgroundTexture = resources.getTexture("assets/menu_background.jpg", loader);
+    if (!loader) finishLoading();
+}
+
+void Menu::finishLoading() {
+    backgroundSprite.setTexture(*backgroundTexture, true);
+}
+
+void Menu::releaseBackground() {
+    // The sprite keeps a raw pointer to the texture, so it has to let go first
+    backgroundSprite = sf::Sprite();
+    backgroundTexture.reset();
+}
+
 void Menu::handleInput(sf::RenderWindow& window, GameState& gameState, sf::Music& backgroundMusic) {
     if (sf::Mouse::isButtonPressed(sf::Mouse::Left)) {
         sf::Vector2i mousePos = sf::Mouse::getPosition(window);
@@ -4,23 +4,31 @@
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
 #include "Constants.hpp"
+#include "AssetLoader.hpp"
+#include "ResourceCache.hpp"
 
 class Menu {
 private:
-    sf::Font font;
+    ResourceCache& resources;
+    std::shared_ptr<sf::Font> font;
     sf::Text startText;
     sf::Text soundText;
     sf::Text title;
     sf::Text highScoreText;
     bool soundOn;
     int highScore;
-    sf::Texture backgroundTexture;
+    std::shared_ptr<sf::Texture> backgroundTexture;
     sf::Sprite backgroundSprite;
 
     void centerTextMenu(sf::Text& text, int windowWidth, int windowHeight, int yOffset);
 
 public:
-    Menu(int highScore);
+    Menu(ResourceCache& resources, int highScore);
+
+    // Without a loader the background is loaded immediately; with one, call finishLoading() afterwards
+    void loadBackground(AssetLoader* loader = nullptr);
+    void finishLoading();
+    void releaseBackground();
 
     void handleInput(sf::RenderWindow& window, GameState& gameState, sf::Music& backgroundMusic);
     void render(sf::RenderWindow& window);
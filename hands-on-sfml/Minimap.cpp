@@ -0,0 +1,80 @@
+#include "Minimap.hpp"
+#include <algorithm>
+#include <iostream>
+
+Minimap::Minimap(unsigned int size, float worldSize, float refreshRate)
+    : size(size), scale(size / worldSize), dots(sf::Triangles) {
+    setRefreshRate(refreshRate);
+
+    if (!staticLayer.create(size, size) || !composed.create(size, size)) {
+        std::cerr << "Error creating minimap render textures!\n";
+    }
+    staticSprite.setTexture(staticLayer.getTexture());
+    composedSprite.setTexture(composed.getTexture());
+}
+
+void Minimap::setRefreshRate(float refreshesPerSecond) {
+    refreshInterval = refreshesPerSecond > 0 ? 1.0f / refreshesPerSecond : 0.0f;
+}
+
+void Minimap::bake(const sf::Sprite& background, const std::vector<Obstacle>& obstacles) {
+    staticLayer.clear(sf::Color::Black);
+
+    sf::RenderStates worldToMap;
+    worldToMap.transform.scale(scale, scale);
+    staticLayer.draw(background, worldToMap);
+
+    // Obstacles as white rectangles at their true footprint, never smaller than 2px
+    sf::VertexArray obstacleShapes(sf::Triangles);
+    for (const auto& obstacle : obstacles) {
+        sf::FloatRect bounds = obstacle.getBounds();
+        float left = bounds.left * scale, top = bounds.top * scale;
+        float right = left + std::max(2.0f, bounds.width * scale);
+        float bottom = top + std::max(2.0f, bounds.height * scale);
+
+        obstacleShapes.append(sf::Vertex(sf::Vector2f(left, top), sf::Color::White));
+        obstacleShapes.append(sf::Vertex(sf::Vector2f(left, bottom), sf::Color::White));
+        obstacleShapes.append(sf::Vertex(sf::Vector2f(right, top), sf::Color::White));
+        obstacleShapes.append(sf::Vertex(sf::Vector2f(right, top), sf::Color::White));
+        obstacleShapes.append(sf::Vertex(sf::Vector2f(left, bottom), sf::Color::White));
+        obstacleShapes.append(sf::Vertex(sf::Vector2f(right, bottom), sf::Color::White));
+    }
+    staticLayer.draw(obstacleShapes);
+    staticLayer.display();
+
+    hasContent = false;
+}
+
+void Minimap::appendDot(sf::Vector2f worldPosition, float radius, sf::Color color) {
+    sf::Vector2f centre = worldPosition * scale;
+    sf::Vector2f topLeft(centre.x - radius, centre.y - radius);
+    sf::Vector2f bottomRight(centre.x + radius, centre.y + radius);
+
+    dots.append(sf::Vertex(topLeft, color));
+    dots.append(sf::Vertex(sf::Vector2f(topLeft.x, bottomRight.y), color));
+    dots.append(sf::Vertex(sf::Vector2f(bottomRight.x, topLeft.y), color));
+    dots.append(sf::Vertex(sf::Vector2f(bottomRight.x, topLeft.y), color));
+    dots.append(sf::Vertex(sf::Vector2f(topLeft.x, bottomRight.y), color));
+    dots.append(sf::Vertex(bottomRight, color));
+}
+
+void Minimap::update(sf::Vector2f playerPosition, const ZombieArchetype& zombies, bool force) {
+    if (hasContent && !force && refreshClock.getElapsedTime().asSeconds() < refreshInterval) return;
+    refreshClock.restart();
+    hasContent = true;
+
+    // Vertex storage is reused between refreshes, so this does not allocate in steady state
+    dots.clear();
+    for (size_t i = 0; i < zombies.size(); ++i)
+        appendDot(zombies.position[i] + zombies.extent * 0.5f, 2.0f, sf::Color::Red);
+    appendDot(playerPosition, 3.0f, sf::Color::Blue);
+
+    composed.clear(sf::Color::Black);
+    composed.draw(staticSprite);
+    composed.draw(dots);
+    composed.display();
+}
+
+void Minimap::render(sf::RenderTarget& target) {
+    target.draw(composedSprite);
+}
@@ -0,0 +1,39 @@
+#ifndef MINIMAP_HPP
+#define MINIMAP_HPP
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include "EntityStore.hpp"
+#include "Obstacle.hpp"
+
+// Whole-world overview in the corner of the HUD. The background and obstacles are baked
+// once into a static layer; player and zombie dots are composed on top of it from one
+// vertex array, and only every 1 / refreshRate seconds. Other frames just blit the result.
+class Minimap {
+public:
+    Minimap(unsigned int size, float worldSize, float refreshRate);
+
+    void bake(const sf::Sprite& background, const std::vector<Obstacle>& obstacles);
+    void setRefreshRate(float refreshesPerSecond);
+    void setPosition(sf::Vector2f position) { composedSprite.setPosition(position); }
+
+    void update(sf::Vector2f playerPosition, const ZombieArchetype& zombies, bool force = false);
+    void render(sf::RenderTarget& target);
+
+private:
+    unsigned int size;
+    float scale;
+    float refreshInterval;
+    sf::Clock refreshClock;
+    bool hasContent = false;
+
+    sf::RenderTexture staticLayer;
+    sf::RenderTexture composed;
+    sf::Sprite staticSprite;
+    sf::Sprite composedSprite;
+    sf::VertexArray dots;
+
+    void appendDot(sf::Vector2f worldPosition, float radius, sf::Color color);
+};
+
+#endif // MINIMAP_HPP
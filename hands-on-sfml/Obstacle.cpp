@@ -1,17 +1,16 @@
 #include "Obstacle.hpp"
 
-Obstacle::Obstacle(sf::Texture& texture, sf::Vector2f position) {
+Obstacle::Obstacle(const sf::Texture& texture, const sf::IntRect& textureRect, sf::Vector2f position) {
     sprite.setTexture(texture);
+    sprite.setTextureRect(textureRect);
     sprite.setScale(1.0f, 1.0f);
     sprite.setPosition(position);
-
-    texture.setSmooth(true);
 }
 
 void Obstacle::render(sf::RenderWindow& window) {
     window.draw(sprite);
 }
 
-sf::FloatRect Obstacle::getBounds() {
+sf::FloatRect Obstacle::getBounds() const {
     return sprite.getGlobalBounds();
 }
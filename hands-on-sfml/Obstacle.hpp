@@ -7,10 +7,10 @@ class Obstacle {
 public:
     sf::Sprite sprite;
 
-    Obstacle(sf::Texture& texture, sf::Vector2f position);
+    Obstacle(const sf::Texture& texture, const sf::IntRect& textureRect, sf::Vector2f position);
 
     void render(sf::RenderWindow& window);
-    sf::FloatRect getBounds();
+    sf::FloatRect getBounds() const;
 };
 
 #endif
@@ -0,0 +1,129 @@
+#include "PackedBounds.hpp"
+#include <algorithm>
+#include <limits>
+
+#if SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace {
+    const size_t LANES = 8;
+
+    struct Box {
+        float minX, minY, maxX, maxY;
+    };
+
+    struct Columns {
+        const float* minX;
+        const float* minY;
+        const float* maxX;
+        const float* maxY;
+    };
+
+    // max(minA, minB) < min(maxA, maxB) on both axes, which is what sf::FloatRect::intersects
+    // computes, reduces to these four compares once neither box is empty
+    unsigned int maskScalar(const Columns& boxes, const Box& area, const int* indices, size_t count) {
+        unsigned int mask = 0;
+        for (size_t k = 0; k < count; ++k) {
+            int i = indices[k];
+            if (area.minX < boxes.maxX[i] && boxes.minX[i] < area.maxX && area.minY < boxes.maxY[i] && boxes.minY[i] < area.maxY)
+                mask |= 1u << k;
+        }
+        return mask;
+    }
+
+#if SIMD_X86
+    // Two halves of four; SSE2 has no gather, so each lane is loaded on its own
+    unsigned int maskSse2(const Columns& boxes, const Box& area, const int* lanes, size_t count) {
+        const __m128 areaMinX = _mm_set1_ps(area.minX), areaMaxX = _mm_set1_ps(area.maxX);
+        const __m128 areaMinY = _mm_set1_ps(area.minY), areaMaxY = _mm_set1_ps(area.maxY);
+        unsigned int mask = 0;
+        for (size_t half = 0; half < count; half += 4) {
+            const int* i = lanes + half;
+            __m128 minX = _mm_setr_ps(boxes.minX[i[0]], boxes.minX[i[1]], boxes.minX[i[2]], boxes.minX[i[3]]);
+            __m128 minY = _mm_setr_ps(boxes.minY[i[0]], boxes.minY[i[1]], boxes.minY[i[2]], boxes.minY[i[3]]);
+            __m128 maxX = _mm_setr_ps(boxes.maxX[i[0]], boxes.maxX[i[1]], boxes.maxX[i[2]], boxes.maxX[i[3]]);
+            __m128 maxY = _mm_setr_ps(boxes.maxY[i[0]], boxes.maxY[i[1]], boxes.maxY[i[2]], boxes.maxY[i[3]]);
+            __m128 hit = _mm_and_ps(_mm_and_ps(_mm_cmplt_ps(areaMinX, maxX), _mm_cmplt_ps(minX, areaMaxX)),
+                _mm_and_ps(_mm_cmplt_ps(areaMinY, maxY), _mm_cmplt_ps(minY, areaMaxY)));
+            mask |= static_cast<unsigned int>(_mm_movemask_ps(hit)) << half;
+        }
+        return mask;
+    }
+
+    SIMD_TARGET_AVX2
+    unsigned int maskAvx2(const Columns& boxes, const Box& area, const int* lanes) {
+        __m256i index = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lanes));
+        __m256 minX = _mm256_i32gather_ps(boxes.minX, index, 4);
+        __m256 minY = _mm256_i32gather_ps(boxes.minY, index, 4);
+        __m256 maxX = _mm256_i32gather_ps(boxes.maxX, index, 4);
+        __m256 maxY = _mm256_i32gather_ps(boxes.maxY, index, 4);
+        __m256 hitX = _mm256_and_ps(_mm256_cmp_ps(_mm256_set1_ps(area.minX), maxX, _CMP_LT_OQ),
+            _mm256_cmp_ps(minX, _mm256_set1_ps(area.maxX), _CMP_LT_OQ));
+        __m256 hitY = _mm256_and_ps(_mm256_cmp_ps(_mm256_set1_ps(area.minY), maxY, _CMP_LT_OQ),
+            _mm256_cmp_ps(minY, _mm256_set1_ps(area.maxY), _CMP_LT_OQ));
+        return static_cast<unsigned int>(_mm256_movemask_ps(_mm256_and_ps(hitX, hitY)));
+    }
+#endif
+
+    int lowestBit(unsigned int mask) {
+        int bit = 0;
+        for (; (mask & 1) == 0; mask >>= 1) bit++;
+        return bit;
+    }
+}
+
+void PackedBounds::clear() {
+    minX.clear();
+    minY.clear();
+    maxX.clear();
+    maxY.clear();
+    level = getSimdLevel();
+}
+
+void PackedBounds::add(const sf::FloatRect& box) {
+    minX.push_back(box.left);
+    minY.push_back(box.top);
+    maxX.push_back(box.left + box.width);
+    maxY.push_back(box.top + box.height);
+    if (box.width <= 0 || box.height <= 0) disable(static_cast<int>(size() - 1));
+}
+
+void PackedBounds::disable(int index) {
+    // Inverted to infinity: every compare against it fails
+    minX[index] = minY[index] = std::numeric_limits<float>::infinity();
+    maxX[index] = maxY[index] = -std::numeric_limits<float>::infinity();
+}
+
+unsigned int PackedBounds::overlapMask(const sf::FloatRect& area, const int* indices, size_t count) const {
+    if (count == 0 || area.width <= 0 || area.height <= 0) return 0;
+    Box box = { area.left, area.top, area.left + area.width, area.top + area.height };
+    Columns boxes = { minX.data(), minY.data(), maxX.data(), maxY.data() };
+
+#if SIMD_X86
+    if (level != SimdLevel::Scalar) {
+        // A short block repeats its first index in the spare lanes, and their bits are dropped
+        int padded[LANES];
+        const int* lanes = indices;
+        if (count < LANES) {
+            std::fill(padded, padded + LANES, indices[0]);
+            std::copy(indices, indices + count, padded);
+            lanes = padded;
+        }
+        unsigned int valid = (1u << count) - 1;
+        if (level == SimdLevel::AVX2) return maskAvx2(boxes, box, lanes) & valid;
+        return maskSse2(boxes, box, lanes, count) & valid;
+    }
+#endif
+    return maskScalar(boxes, box, indices, count);
+}
+
+int PackedBounds::firstOverlap(const sf::FloatRect& area, const std::vector<int>& indices) const {
+    // Blocks are tested in order and the lowest bit wins, so the first hit is the same as a linear scan's
+    for (size_t first = 0; first < indices.size(); first += LANES) {
+        size_t count = std::min(LANES, indices.size() - first);
+        unsigned int mask = overlapMask(area, indices.data() + first, count);
+        if (mask != 0) return indices[first + lowestBit(mask)];
+    }
+    return -1;
+}
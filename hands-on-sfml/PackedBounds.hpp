@@ -0,0 +1,33 @@
+#ifndef PACKEDBOUNDS_HPP
+#define PACKEDBOUNDS_HPP
+
+#include <SFML/Graphics/Rect.hpp>
+#include <vector>
+#include "CpuFeatures.hpp"
+
+// Axis-aligned boxes kept as four arrays (min x, min y, max x, max y) so one box can be tested
+// against 8 others at once: a single AVX2 compare per edge, two with SSE2. Overlap follows
+// sf::FloatRect::intersects exactly: touching edges do not count, and an empty box never overlaps.
+class PackedBounds {
+public:
+    // Also picks up the current getSimdLevel()
+    void clear();
+    void add(const sf::FloatRect& box);
+    // The box stays in place, so indices keep their meaning, but is never hit again
+    void disable(int index);
+    size_t size() const { return minX.size(); }
+
+    // Bit k is set when the box at indices[k] overlaps 'area'; count is at most 8
+    unsigned int overlapMask(const sf::FloatRect& area, const int* indices, size_t count) const;
+    // The first of 'indices', in their order, whose box overlaps 'area', or -1
+    int firstOverlap(const sf::FloatRect& area, const std::vector<int>& indices) const;
+
+private:
+    std::vector<float> minX;
+    std::vector<float> minY;
+    std::vector<float> maxX;
+    std::vector<float> maxY;
+    SimdLevel level = SimdLevel::Scalar;
+};
+
+#endif // PACKEDBOUNDS_HPP
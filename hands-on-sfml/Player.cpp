@@ -1,65 +1,78 @@
 #include "Player.hpp"
-#include <iostream>
+#include "Profiler.hpp"
 
-Player::Player(sf::Texture& texture) : Entity(texture, 0.25f), health(PLAYER_MAX_HEALTH) {
-    sprite.setPosition(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2);
-
-    sf::FloatRect bounds = sprite.getLocalBounds();
-    sprite.setOrigin(bounds.width / 2, bounds.height / 2);
-}
-
-void Player::displayInfo() {
-	std::cout << "Player created" << std::endl;
+Player::Player() : position(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2), health(PLAYER_MAX_HEALTH) {
+    storePreviousState();
 }
 
-void Player::move(std::vector<Obstacle>& obstacles) {
-    sf::Vector2f newPosition = sprite.getPosition();
+void Player::move(float deltaTime, const InputState& input, const StaticCollisionWorld& staticWorld, const sf::FloatRect& area) {
+    PROFILE_SCOPE("player_move");
+    sf::Vector2f newPosition = position;
     sf::Vector2f oldPosition = newPosition;
 
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::W)) newPosition.y -= PLAYER_SPEED;
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::S)) newPosition.y += PLAYER_SPEED;
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::A)) newPosition.x -= PLAYER_SPEED;
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::D)) newPosition.x += PLAYER_SPEED;
+    float step = PLAYER_SPEED * deltaTime;
+    float turn = PLAYER_ROTATION_SPEED * deltaTime;
 
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Left)) sprite.rotate(-0.05f);
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Right)) sprite.rotate(0.05f);
+    if (input.up) newPosition.y -= step;
+    if (input.down) newPosition.y += step;
+    if (input.left) newPosition.x -= step;
+    if (input.right) newPosition.x += step;
+
+    if (input.turnLeft) rotation -= turn;
+    if (input.turnRight) rotation += turn;
+    rotation = std::fmod(rotation, 360.0f);
+    if (rotation < 0) rotation += 360.0f;
 
     // Check collision with obstacles
-    sf::FloatRect newBounds = sprite.getGlobalBounds();
+    sf::FloatRect newBounds = getBounds();
     newBounds.left = newPosition.x;
     newBounds.top = newPosition.y;
 
-    bool collision = false;
-    for (auto& obstacle : obstacles) {
-        if (newBounds.intersects(obstacle.sprite.getGlobalBounds())) {
-            collision = true;
-            break;
-        }
-    }
+    bool collision = staticWorld.overlaps(newBounds);
 
     // Move only if no collision
-    float minX = 0, minY = 0;
-    float maxX = 2000 - newBounds.width;
-    float maxY = 2000 - newBounds.height;
+    float minX = area.left, minY = area.top;
+    float maxX = area.left + area.width - newBounds.width;
+    float maxY = area.top + area.height - newBounds.height;
 
     if (!collision) {
         newPosition.x = std::max(minX, std::min(maxX, newPosition.x));
         newPosition.y = std::max(minY, std::min(maxY, newPosition.y));
 
-        sprite.setPosition(newPosition);
+        position = newPosition;
     }
     else {
-        sprite.setPosition(oldPosition);  // Revert to old position if blocked
+        position = oldPosition;  // Revert to old position if blocked
     }
 }
 
-void Player::updateBoosts() {
-    if (speedBoost && speedBoostClock.getElapsedTime().asSeconds() > 5) speedBoost = false;
-    if (damageBoost && damageBoostClock.getElapsedTime().asSeconds() > 5) damageBoost = false;
+void Player::updateBoosts(float deltaTime) {
+    speedBoostTime += deltaTime;
+    damageBoostTime += deltaTime;
+    if (speedBoost && speedBoostTime > BOOST_DURATION) speedBoost = false;
+    if (damageBoost && damageBoostTime > BOOST_DURATION) damageBoost = false;
 }
 
-sf::Vector2f Player::getDirection() {
-    float angle = sprite.getRotation() - 90;
+sf::Vector2f Player::getDirection() const {
+    float angle = rotation - 90;
     float rad = angle * 3.14159265f / 180;
     return sf::Vector2f(std::cos(rad), std::sin(rad));
 }
+
+sf::FloatRect Player::getBounds() const {
+    float rad = rotation * 3.14159265f / 180;
+    float c = std::abs(std::cos(rad));
+    float s = std::abs(std::sin(rad));
+    float width = extent.x * c + extent.y * s;
+    float height = extent.x * s + extent.y * c;
+    return sf::FloatRect(position.x - width / 2, position.y - height / 2, width, height);
+}
+
+void Player::storePreviousState() {
+    previousPosition = position;
+    previousRotation = rotation;
+}
+
+sf::Vector2f Player::getInterpolatedPosition(float alpha) const {
+    return previousPosition + (position - previousPosition) * alpha;
+}
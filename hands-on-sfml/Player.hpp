@@ -1,27 +1,43 @@
 #ifndef PLAYER_HPP
 #define PLAYER_HPP
 
-#include "Entity.hpp"
-#include "Obstacle.hpp"
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include "InputSource.hpp"
+#include "StaticCollisionWorld.hpp"
 #include "Constants.hpp"
 #include <vector>
 #include <cmath>
 #include <algorithm>
 
-class Player : public Entity {
+// Plain simulation data: position is the sprite centre, extent the unrotated size of the
+// scaled sprite. Rendering is done by Game from these fields.
+class Player {
 public:
+    sf::Vector2f position;
+    float rotation = 0.0f;
+    sf::Vector2f previousPosition;
+    float previousRotation = 0.0f;
+    sf::Vector2f extent;
     int health;
     bool speedBoost = false;
     bool damageBoost = false;
-    sf::Clock speedBoostClock;
-    sf::Clock damageBoostClock;
+    float speedBoostTime = 0.0f;
+    float damageBoostTime = 0.0f;
 
-    Player(sf::Texture& texture);
+    Player();
 
-    void move(std::vector<Obstacle>& obstacles);
-    void updateBoosts();
-    sf::Vector2f getDirection();
-	void displayInfo() override;
+    // Keeps the player's box inside 'area'
+    void move(float deltaTime, const InputState& input, const StaticCollisionWorld& staticWorld, const sf::FloatRect& area);
+    void updateBoosts(float deltaTime);
+    sf::Vector2f getDirection() const;
+
+    // Axis-aligned box around the rotated sprite, same as sf::Sprite::getGlobalBounds
+    sf::FloatRect getBounds() const;
+
+    // Remembers the current transform so rendering can blend between two sim ticks
+    void storePreviousState();
+    sf::Vector2f getInterpolatedPosition(float alpha) const;
 };
 
 #endif // PLAYER_HPP
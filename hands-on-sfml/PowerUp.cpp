@@ -1,27 +1,18 @@
 #include "PowerUp.hpp"
-#include <iostream>
+#include "Player.hpp"
 
-PowerUp::PowerUp(sf::Texture& texture, sf::Vector2f position, Type powerUpType)
-    : Entity(texture, 0.2f), type(powerUpType) {
-    sprite.setPosition(position);
-}
-
-void PowerUp::displayInfo() {
-	std::cout << "PowerUp created" << std::endl;
-}
-
-void PowerUp::applyEffect(Player& player) {
+void PowerUp::applyEffect(Type type, Player& player) {
     switch (type) {
     case HEALTH:
         player.health = std::min(player.health + 5, PLAYER_MAX_HEALTH);
         break;
     case SPEED:
         player.speedBoost = true;
-        player.speedBoostClock.restart();
+        player.speedBoostTime = 0.0f;
         break;
     case DAMAGE:
         player.damageBoost = true;
-        player.damageBoostClock.restart();
+        player.damageBoostTime = 0.0f;
         break;
     }
 }
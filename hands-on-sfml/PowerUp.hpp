@@ -1,20 +1,16 @@
 #ifndef POWERUP_HPP
 #define POWERUP_HPP
 
-#include "Entity.hpp"
-#include "Player.hpp"
 #include "Constants.hpp"
 #include <algorithm>
 
-class PowerUp : public Entity {
+class Player;
+
+class PowerUp {
 public:
     enum Type { HEALTH, SPEED, DAMAGE };
-    Type type;
-
-    PowerUp(sf::Texture& texture, sf::Vector2f position, Type powerUpType);
 
-    void applyEffect(Player& player);
-	void displayInfo() override;
+    static void applyEffect(Type type, Player& player);
 };
 
 #endif // POWERUP_HPP
@@ -0,0 +1,119 @@
+#include "Profiler.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+thread_local bool Profiler::frameThread = false;
+
+Profiler& Profiler::get() {
+    static Profiler profiler;
+    return profiler;
+}
+
+Profiler::Profiler() : frameStart(Clock::now()), frameMs(PROFILER_HISTORY, 0.0f),
+    scopeMs(PROFILER_HISTORY * PROFILER_MAX_SCOPES, 0.0f) {
+    std::fill(current, current + PROFILER_MAX_SCOPES, Clock::duration::zero());
+    names.reserve(PROFILER_MAX_SCOPES);
+    depths.reserve(PROFILER_MAX_SCOPES);
+}
+
+int Profiler::registerScope(const char* name) {
+    // Called once per marker through a function-local static, so a linear search is fine.
+    // Markers with the same name in different functions share one scope. Markers first reached
+    // on another thread are never timed, so they are not registered (and the registry stays
+    // single-threaded).
+    if (!frameThread) return -1;
+    for (size_t i = 0; i < names.size(); ++i)
+        if (std::strcmp(names[i], name) == 0) return static_cast<int>(i);
+
+    if (names.size() == PROFILER_MAX_SCOPES) {
+        std::cerr << "Error: too many profiler scopes, " << name << " is counted as " << names.back() << "!\n";
+        return PROFILER_MAX_SCOPES - 1;
+    }
+
+    names.push_back(name);
+    depths.push_back(depth);
+    return static_cast<int>(names.size() - 1);
+}
+
+void Profiler::beginFrame() {
+    frameThread = true;
+    frameStart = Clock::now();
+    std::fill(current, current + PROFILER_MAX_SCOPES, Clock::duration::zero());
+}
+
+void Profiler::endFrame() {
+    auto toMs = [](Clock::duration elapsed) {
+        return std::chrono::duration<float, std::milli>(elapsed).count();
+    };
+
+    Clock::time_point frameEnd = Clock::now();
+    int index = static_cast<int>(frameCount % PROFILER_HISTORY);
+    frameMs[index] = toMs(frameEnd - frameStart);
+    float* scopes = &scopeMs[index * PROFILER_MAX_SCOPES];
+    for (int i = 0; i < PROFILER_MAX_SCOPES; ++i)
+        scopes[i] = toMs(current[i]);
+    frameCount++;
+
+    TraceRecorder& trace = TraceRecorder::get();
+    trace.complete("frame", frameStart, frameEnd);
+    trace.frameEnded(frameStart, frameMs[index]);
+}
+
+float Profiler::getAverageScopeMs(int scope, int frames) const {
+    frames = std::min(frames, getFrameCount());
+    if (frames == 0) return 0.0f;
+
+    float total = 0.0f;
+    for (int age = 0; age < frames; ++age)
+        total += getScopeMs(age, scope);
+    return total / frames;
+}
+
+void Profiler::writeCsv(std::ostream& out, int frames) const {
+    frames = std::min(frames, getFrameCount());
+
+    out << "frame,frame_ms";
+    for (const char* name : names)
+        out << ',' << name;
+    out << '\n';
+
+    for (int age = frames - 1; age >= 0; --age) {
+        out << frameCount - 1 - age << ',' << getFrameMs(age);
+        for (int scope = 0; scope < getScopeCount(); ++scope)
+            out << ',' << getScopeMs(age, scope);
+        out << '\n';
+    }
+}
+
+void Profiler::writeJson(std::ostream& out, int frames) const {
+    frames = std::min(frames, getFrameCount());
+
+    out << "{\n  \"scopes\": [";
+    for (size_t i = 0; i < names.size(); ++i)
+        out << (i ? ", " : "") << '"' << names[i] << '"';
+    out << "],\n  \"frames\": [\n";
+
+    for (int age = frames - 1; age >= 0; --age) {
+        out << "    { \"frame\": " << frameCount - 1 - age << ", \"frame_ms\": " << getFrameMs(age) << ", \"scope_ms\": [";
+        for (int scope = 0; scope < getScopeCount(); ++scope)
+            out << (scope ? ", " : "") << getScopeMs(age, scope);
+        out << "] }" << (age > 0 ? "," : "") << '\n';
+    }
+    out << "  ]\n}\n";
+}
+
+bool Profiler::dump(const std::string& pathPrefix, int frames) const {
+    std::ofstream csv(pathPrefix + ".csv");
+    std::ofstream json(pathPrefix + ".json");
+    if (!csv.is_open() || !json.is_open()) {
+        std::cerr << "Error writing profile to " << pathPrefix << "!\n";
+        return false;
+    }
+
+    writeCsv(csv, frames);
+    writeJson(json, frames);
+    std::cout << "Wrote " << std::min(frames, getFrameCount()) << " profiled frames to " << pathPrefix << ".csv/.json" << std::endl;
+    return true;
+}
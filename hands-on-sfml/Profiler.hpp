@@ -0,0 +1,99 @@
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "Constants.hpp"
+#include "TraceRecorder.hpp"
+
+// Per-frame scope timings for the main thread. Each PROFILE_SCOPE adds the time until the end
+// of its block to that scope's total for the current frame; PROFILE_FRAME_END closes the frame
+// into a ring buffer of the last PROFILER_HISTORY frames. Scope names must be string literals.
+// Only the thread that runs the frames (the one calling PROFILE_FRAME_BEGIN) is timed; markers
+// reached on other threads, such as the simulation thread, only go to the trace. Every
+// PROFILE_SCOPE is recorded in the trace.
+class Profiler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static Profiler& get();
+    static bool isFrameThread() { return frameThread; }
+
+    int registerScope(const char* name);
+    void enter() { depth++; }
+    void leave(int scope, Clock::duration elapsed) {
+        depth--;
+        current[scope] += elapsed;
+    }
+
+    void beginFrame();
+    void endFrame();
+
+    int getScopeCount() const { return static_cast<int>(names.size()); }
+    const char* getScopeName(int scope) const { return names[scope]; }
+    int getScopeDepth(int scope) const { return depths[scope]; }
+
+    // Frames are addressed by age: 0 is the most recently completed frame
+    int getFrameCount() const { return frameCount < PROFILER_HISTORY ? static_cast<int>(frameCount) : PROFILER_HISTORY; }
+    float getFrameMs(int age) const { return frameMs[slot(age)]; }
+    float getScopeMs(int age, int scope) const { return scopeMs[slot(age) * PROFILER_MAX_SCOPES + scope]; }
+    float getAverageScopeMs(int scope, int frames) const;
+
+    // Oldest frame first; 'frames' is clamped to what the ring buffer holds
+    void writeCsv(std::ostream& out, int frames) const;
+    void writeJson(std::ostream& out, int frames) const;
+    bool dump(const std::string& pathPrefix, int frames = PROFILER_HISTORY) const;
+
+private:
+    Profiler();
+
+    static thread_local bool frameThread;
+    std::vector<const char*> names;
+    std::vector<int> depths;
+    int depth = 0;
+
+    Clock::time_point frameStart;
+    Clock::duration current[PROFILER_MAX_SCOPES];
+
+    std::vector<float> frameMs;   // PROFILER_HISTORY entries
+    std::vector<float> scopeMs;   // PROFILER_HISTORY * PROFILER_MAX_SCOPES entries
+    long long frameCount = 0;
+
+    int slot(int age) const { return static_cast<int>((frameCount - 1 - age) % PROFILER_HISTORY); }
+};
+
+class ProfileScope {
+public:
+    explicit ProfileScope(int scope) : scope(Profiler::isFrameThread() ? scope : -1), start(Profiler::Clock::now()) {
+        if (this->scope >= 0) Profiler::get().enter();
+    }
+    ~ProfileScope() {
+        if (scope >= 0) Profiler::get().leave(scope, Profiler::Clock::now() - start);
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    int scope;
+    Profiler::Clock::time_point start;
+};
+
+#if PROFILER_ENABLED
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) \
+    static const int PROFILE_CONCAT(profileScopeId, __LINE__) = Profiler::get().registerScope(name); \
+    ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(PROFILE_CONCAT(profileScopeId, __LINE__)); \
+    TRACE_SCOPE(name)
+#define PROFILE_FRAME_BEGIN() Profiler::get().beginFrame()
+#define PROFILE_FRAME_END() Profiler::get().endFrame()
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_FRAME_BEGIN() ((void)0)
+#define PROFILE_FRAME_END() ((void)0)
+#endif
+
+#endif // PROFILER_HPP
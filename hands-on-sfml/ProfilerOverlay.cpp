@@ -0,0 +1,60 @@
+#include "ProfilerOverlay.hpp"
+#include "Helper.hpp"
+#include <algorithm>
+#include <cstdio>
+
+namespace {
+    const unsigned int CHARACTER_SIZE = 12;
+    const float LINE_HEIGHT = 15.0f;
+    const float PANEL_WIDTH = PROFILER_HISTORY + 20.0f;
+    const float GRAPH_HEIGHT = 60.0f;
+    const int AVERAGE_FRAMES = 60;
+}
+
+ProfilerOverlay::ProfilerOverlay(const sf::Font& font) : font(font), origin(10, 40) {
+}
+
+void ProfilerOverlay::render(sf::RenderTarget& target, const Profiler& profiler) {
+    vertices.clear();
+
+    int scopeCount = profiler.getScopeCount();
+    int frames = profiler.getFrameCount();
+    float panelHeight = (scopeCount + 1) * LINE_HEIGHT + GRAPH_HEIGHT + 20.0f;
+    appendGlyphQuad(vertices, origin.x, origin.y, PANEL_WIDTH, panelHeight, sf::Color(0, 0, 0, 180));
+
+    char line[64];
+    float left = origin.x + 10.0f;
+    float top = origin.y + 5.0f;
+    float frameAverage = 0.0f;
+    for (int age = 0; age < std::min(frames, AVERAGE_FRAMES); ++age)
+        frameAverage += profiler.getFrameMs(age) / std::min(frames, AVERAGE_FRAMES);
+    std::snprintf(line, sizeof(line), "frame %6.2f ms  (avg of %d)", frameAverage, AVERAGE_FRAMES);
+    appendGlyphText(vertices, font, CHARACTER_SIZE, line, left, top, sf::Color::White);
+
+    // One row per scope, indented by nesting depth, with a bar relative to the frame budget
+    for (int scope = 0; scope < scopeCount; ++scope) {
+        top += LINE_HEIGHT;
+        float ms = profiler.getAverageScopeMs(scope, AVERAGE_FRAMES);
+        appendGlyphText(vertices, font, CHARACTER_SIZE, profiler.getScopeName(scope), left + profiler.getScopeDepth(scope) * 10.0f, top, sf::Color(200, 200, 200));
+        std::snprintf(line, sizeof(line), "%6.2f", ms);
+        appendGlyphText(vertices, font, CHARACTER_SIZE, line, left + 150.0f, top, sf::Color::White);
+
+        float barWidth = std::min(ms / FRAME_BUDGET_MS, 1.0f) * 100.0f;
+        appendGlyphQuad(vertices, left + 200.0f, top + 3.0f, barWidth, LINE_HEIGHT - 5.0f, sf::Color(80, 160, 255));
+    }
+
+    // Frame-time graph, newest on the right; the line marks the budget at half height
+    float graphTop = top + LINE_HEIGHT + 10.0f;
+    float graphBottom = graphTop + GRAPH_HEIGHT;
+    float graphRight = left + PROFILER_HISTORY;
+    for (int age = 0; age < frames; ++age) {
+        float ms = profiler.getFrameMs(age);
+        float height = std::min(ms / (2.0f * FRAME_BUDGET_MS), 1.0f) * GRAPH_HEIGHT;
+        sf::Color color = ms > FRAME_BUDGET_MS ? sf::Color(255, 80, 80) : sf::Color(80, 220, 80);
+        appendGlyphQuad(vertices, graphRight - age - 1.0f, graphBottom - height, 1.0f, height, color);
+    }
+    appendGlyphQuad(vertices, left, graphBottom - GRAPH_HEIGHT / 2, static_cast<float>(PROFILER_HISTORY), 1.0f, sf::Color::Yellow);
+
+    // The glyph page can grow while glyphs are looked up, so fetch it only once they all exist
+    target.draw(vertices.data(), vertices.size(), sf::Triangles, sf::RenderStates(&font.getTexture(CHARACTER_SIZE)));
+}
@@ -0,0 +1,24 @@
+#ifndef PROFILEROVERLAY_HPP
+#define PROFILEROVERLAY_HPP
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include "Profiler.hpp"
+
+// Per-scope timings and a frame-time graph. Text glyphs, bars and the graph all sample the
+// font's glyph page (which reserves a white square at its origin for solid fills), so the
+// whole overlay goes out as one triangle list and one draw call.
+class ProfilerOverlay {
+public:
+    explicit ProfilerOverlay(const sf::Font& font);
+
+    void setPosition(sf::Vector2f position) { origin = position; }
+    void render(sf::RenderTarget& target, const Profiler& profiler);
+
+private:
+    const sf::Font& font;
+    sf::Vector2f origin;
+    std::vector<sf::Vertex> vertices;
+};
+
+#endif // PROFILEROVERLAY_HPP
@@ -0,0 +1,63 @@
+#include "ProjectilePool.hpp"
+#include <algorithm>
+
+ProjectilePool::ProjectilePool(size_t capacity, DropPolicy policy) : capacity(capacity), policy(policy) {
+    position.reserve(capacity);
+    previousPosition.reserve(capacity);
+    velocity.reserve(capacity);
+    timeToLive.reserve(capacity);
+    texture.reserve(capacity);
+    expired.reserve((capacity + 7) / 8);
+}
+
+bool ProjectilePool::add(sf::Vector2f spawnPosition, sf::Vector2f spawnVelocity, float lifetime, TextureId textureId) {
+    if (size() >= capacity) {
+        dropped++;
+        if (policy == DropPolicy::DropNewest || capacity == 0) return false;
+
+        // Only scanned when the pool is saturated, so the common path stays O(1)
+        size_t oldest = std::min_element(timeToLive.begin(), timeToLive.end()) - timeToLive.begin();
+        position[oldest] = spawnPosition;
+        previousPosition[oldest] = spawnPosition;
+        velocity[oldest] = spawnVelocity;
+        timeToLive[oldest] = lifetime;
+        texture[oldest] = textureId;
+        return true;
+    }
+
+    position.push_back(spawnPosition);
+    previousPosition.push_back(spawnPosition);
+    velocity.push_back(spawnVelocity);
+    timeToLive.push_back(lifetime);
+    texture.push_back(textureId);
+    return true;
+}
+
+void ProjectilePool::remove(size_t index) {
+    size_t last = size() - 1;
+    if (index != last) {
+        position[index] = position[last];
+        previousPosition[index] = previousPosition[last];
+        velocity[index] = velocity[last];
+        timeToLive[index] = timeToLive[last];
+        texture[index] = texture[last];
+    }
+
+    position.pop_back();
+    previousPosition.pop_back();
+    velocity.pop_back();
+    timeToLive.pop_back();
+    texture.pop_back();
+}
+
+void ProjectilePool::clear() {
+    position.clear();
+    previousPosition.clear();
+    velocity.clear();
+    timeToLive.clear();
+    texture.clear();
+}
+
+sf::FloatRect ProjectilePool::bounds(size_t index) const {
+    return sf::FloatRect(position[index], extent);
+}
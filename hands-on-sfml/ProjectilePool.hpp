@@ -0,0 +1,44 @@
+#ifndef PROJECTILEPOOL_HPP
+#define PROJECTILEPOOL_HPP
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <vector>
+#include "TextureId.hpp"
+
+// Fixed-capacity SoA storage shared by player and zombie bullets. All arrays are reserved
+// up front and never grow; removal swaps the last projectile into the hole, so slot order
+// is not stable and indices are only valid until the next remove().
+class ProjectilePool {
+public:
+    enum class DropPolicy {
+        DropNewest,   // refuse the spawn when full
+        DropOldest    // recycle the projectile closest to expiry
+    };
+
+    std::vector<sf::Vector2f> position;
+    std::vector<sf::Vector2f> previousPosition;
+    std::vector<sf::Vector2f> velocity;
+    std::vector<float> timeToLive;
+    std::vector<TextureId> texture;
+    std::vector<unsigned char> expired;   // updateProjectiles' scratch: one bit per projectile
+    sf::Vector2f extent;
+
+    ProjectilePool(size_t capacity, DropPolicy policy);
+
+    size_t size() const { return position.size(); }
+    size_t getCapacity() const { return capacity; }
+    size_t getDropped() const { return dropped; }
+
+    bool add(sf::Vector2f spawnPosition, sf::Vector2f spawnVelocity, float lifetime, TextureId textureId);
+    void remove(size_t index);
+    void clear();
+    sf::FloatRect bounds(size_t index) const;
+
+private:
+    size_t capacity;
+    DropPolicy policy;
+    size_t dropped = 0;
+};
+
+#endif // PROJECTILEPOOL_HPP
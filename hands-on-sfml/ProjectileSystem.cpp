@@ -0,0 +1,161 @@
+#include "ProjectileSystem.hpp"
+#include "CpuFeatures.hpp"
+#include "Profiler.hpp"
+
+#if SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace {
+    struct Limits {
+        float minX, minY, maxX, maxY;
+    };
+
+    // Kernels advance positions and lifetimes and set bit i of 'expired' (8 projectiles per
+    // byte) when projectile i ran out of time or left the limits. Each returns how many did.
+    // They all compute position + velocity * deltaTime as a multiply then an add, exactly like
+    // the scalar one, so every level produces the same bits.
+
+    size_t integrateScalar(sf::Vector2f* position, const sf::Vector2f* velocity, float* timeToLive,
+        unsigned char* expired, size_t first, size_t count, float deltaTime, const Limits& limits) {
+        size_t expiredCount = 0;
+        for (size_t i = first; i < count; ++i) {
+            if ((i & 7) == 0) expired[i >> 3] = 0;
+
+            position[i].x += velocity[i].x * deltaTime;
+            position[i].y += velocity[i].y * deltaTime;
+            timeToLive[i] -= deltaTime;
+
+            const sf::Vector2f& p = position[i];
+            if (timeToLive[i] <= 0 || p.x < limits.minX || p.x > limits.maxX || p.y < limits.minY || p.y > limits.maxY) {
+                expired[i >> 3] |= static_cast<unsigned char>(1 << (i & 7));
+                expiredCount++;
+            }
+        }
+        return expiredCount;
+    }
+
+#if SIMD_X86
+    // Positions are interleaved x, y, so a compare mask has two bits per projectile; this folds
+    // each pair into one bit: PAIR_BITS[xyxy] = one bit for each of the two projectiles
+    const unsigned char PAIR_BITS[16] = { 0, 1, 1, 1, 2, 3, 3, 3, 2, 3, 3, 3, 2, 3, 3, 3 };
+
+    size_t countBits(unsigned int bits) {
+        size_t count = 0;
+        for (; bits; bits &= bits - 1) count++;
+        return count;
+    }
+
+    // Eight projectiles per iteration: four vectors of two positions, two of four lifetimes
+    size_t integrateSse2(sf::Vector2f* position, const sf::Vector2f* velocity, float* timeToLive,
+        unsigned char* expired, size_t count, float deltaTime, const Limits& limits) {
+        const __m128 step = _mm_set1_ps(deltaTime);
+        const __m128 low = _mm_setr_ps(limits.minX, limits.minY, limits.minX, limits.minY);
+        const __m128 high = _mm_setr_ps(limits.maxX, limits.maxY, limits.maxX, limits.maxY);
+        const __m128 zero = _mm_setzero_ps();
+
+        size_t expiredCount = 0;
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            float* p = &position[i].x;
+            const float* v = &velocity[i].x;
+            unsigned int bits = 0;
+            for (int k = 0; k < 4; ++k) {
+                __m128 moved = _mm_add_ps(_mm_loadu_ps(p + 4 * k), _mm_mul_ps(_mm_loadu_ps(v + 4 * k), step));
+                _mm_storeu_ps(p + 4 * k, moved);
+                __m128 outside = _mm_or_ps(_mm_cmplt_ps(moved, low), _mm_cmpgt_ps(moved, high));
+                bits |= PAIR_BITS[_mm_movemask_ps(outside)] << (2 * k);
+            }
+            for (int k = 0; k < 2; ++k) {
+                __m128 life = _mm_sub_ps(_mm_loadu_ps(timeToLive + i + 4 * k), step);
+                _mm_storeu_ps(timeToLive + i + 4 * k, life);
+                bits |= _mm_movemask_ps(_mm_cmple_ps(life, zero)) << (4 * k);
+            }
+            expired[i >> 3] = static_cast<unsigned char>(bits);
+            expiredCount += countBits(bits);
+        }
+        return expiredCount + integrateScalar(position, velocity, timeToLive, expired, i, count, deltaTime, limits);
+    }
+
+    // Eight projectiles per iteration: two vectors of four positions, one of eight lifetimes
+    SIMD_TARGET_AVX2
+    size_t integrateAvx2(sf::Vector2f* position, const sf::Vector2f* velocity, float* timeToLive,
+        unsigned char* expired, size_t count, float deltaTime, const Limits& limits) {
+        const __m256 step = _mm256_set1_ps(deltaTime);
+        const __m256 low = _mm256_setr_ps(limits.minX, limits.minY, limits.minX, limits.minY,
+            limits.minX, limits.minY, limits.minX, limits.minY);
+        const __m256 high = _mm256_setr_ps(limits.maxX, limits.maxY, limits.maxX, limits.maxY,
+            limits.maxX, limits.maxY, limits.maxX, limits.maxY);
+        const __m256 zero = _mm256_setzero_ps();
+
+        size_t expiredCount = 0;
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            float* p = &position[i].x;
+            const float* v = &velocity[i].x;
+            unsigned int bits = 0;
+            for (int k = 0; k < 2; ++k) {
+                __m256 moved = _mm256_add_ps(_mm256_loadu_ps(p + 8 * k), _mm256_mul_ps(_mm256_loadu_ps(v + 8 * k), step));
+                _mm256_storeu_ps(p + 8 * k, moved);
+                __m256 outside = _mm256_or_ps(_mm256_cmp_ps(moved, low, _CMP_LT_OQ), _mm256_cmp_ps(moved, high, _CMP_GT_OQ));
+                int mask = _mm256_movemask_ps(outside);
+                bits |= (PAIR_BITS[mask & 15] | PAIR_BITS[mask >> 4] << 2) << (4 * k);
+            }
+            __m256 life = _mm256_sub_ps(_mm256_loadu_ps(timeToLive + i), step);
+            _mm256_storeu_ps(timeToLive + i, life);
+            bits |= _mm256_movemask_ps(_mm256_cmp_ps(life, zero, _CMP_LE_OQ));
+
+            expired[i >> 3] = static_cast<unsigned char>(bits);
+            expiredCount += countBits(bits);
+        }
+        return expiredCount + integrateScalar(position, velocity, timeToLive, expired, i, count, deltaTime, limits);
+    }
+#endif
+}
+
+void updateProjectiles(ProjectilePool& projectiles, float deltaTime, const sf::FloatRect& worldBounds) {
+    PROFILE_SCOPE("projectiles");
+    Limits limits = { worldBounds.left, worldBounds.top, worldBounds.left + worldBounds.width, worldBounds.top + worldBounds.height };
+
+    size_t count = projectiles.size();
+    if (count == 0) return;
+    std::vector<unsigned char>& expired = projectiles.expired;
+    expired.resize((count + 7) / 8);
+
+    sf::Vector2f* position = projectiles.position.data();
+    const sf::Vector2f* velocity = projectiles.velocity.data();
+    float* timeToLive = projectiles.timeToLive.data();
+    size_t expiredCount;
+    switch (getSimdLevel()) {
+#if SIMD_X86
+    case SimdLevel::AVX2:
+        expiredCount = integrateAvx2(position, velocity, timeToLive, expired.data(), count, deltaTime, limits);
+        break;
+    case SimdLevel::SSE2:
+        expiredCount = integrateSse2(position, velocity, timeToLive, expired.data(), count, deltaTime, limits);
+        break;
+#endif
+    default:
+        expiredCount = integrateScalar(position, velocity, timeToLive, expired.data(), 0, count, deltaTime, limits);
+        break;
+    }
+
+    // Same result as removing while integrating: remove() moves the last projectile into the
+    // hole, and its flag with it, so that slot is checked again
+    for (size_t i = 0; expiredCount > 0 && i < projectiles.size();) {
+        if ((i & 7) == 0 && expired[i >> 3] == 0) {
+            i += 8;
+            continue;
+        }
+        if ((expired[i >> 3] & (1 << (i & 7))) == 0) {
+            ++i;
+            continue;
+        }
+
+        size_t last = projectiles.size() - 1;
+        if (expired[last >> 3] & (1 << (last & 7))) expired[i >> 3] |= static_cast<unsigned char>(1 << (i & 7));
+        else expired[i >> 3] &= static_cast<unsigned char>(~(1 << (i & 7)));
+        projectiles.remove(i);
+        expiredCount--;
+    }
+}
@@ -0,0 +1,11 @@
+#ifndef PROJECTILESYSTEM_HPP
+#define PROJECTILESYSTEM_HPP
+
+#include "ProjectilePool.hpp"
+
+// Moves every projectile, ages it, and drops the ones that expired or left the world. The
+// integration runs as one vectorized pass at getSimdLevel(); removal then only visits the
+// projectiles that pass flagged.
+void updateProjectiles(ProjectilePool& projectiles, float deltaTime, const sf::FloatRect& worldBounds);
+
+#endif // PROJECTILESYSTEM_HPP
@@ -0,0 +1,7 @@
+#include "ReplayInput.hpp"
+
+InputState ReplayInput::sample() {
+    // Past the end the player just stands still
+    if (finished()) return InputState();
+    return InputRecording::unpack(recording.ticks[tick++]);
+}
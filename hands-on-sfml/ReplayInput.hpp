@@ -0,0 +1,25 @@
+#ifndef REPLAYINPUT_HPP
+#define REPLAYINPUT_HPP
+
+#include "InputRecording.hpp"
+#include "InputSource.hpp"
+
+// Feeds a recording back one tick at a time. Before each step the driver checks
+// restartPending() and resets the simulation if the original run did so at that point.
+class ReplayInput : public InputSource {
+public:
+    explicit ReplayInput(const InputRecording& recording) : recording(recording) {}
+
+    InputState sample() override;
+
+    bool restartPending() const { return !finished() && (recording.ticks[tick] & InputRecording::RESTART) != 0; }
+    bool finished() const { return tick >= recording.ticks.size(); }
+    size_t getTick() const { return tick; }
+    const InputRecording& getRecording() const { return recording; }
+
+private:
+    const InputRecording& recording;
+    size_t tick = 0;
+};
+
+#endif // REPLAYINPUT_HPP
@@ -0,0 +1,116 @@
+#include "ResourceCache.hpp"
+#include <fstream>
+#include <iostream>
+
+namespace {
+    size_t fileSize(const std::string& path) {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        return file.is_open() ? static_cast<size_t>(file.tellg()) : 0;
+    }
+
+    // Estimates of what each resource keeps alive; textures are counted as RGBA8 on the GPU
+    size_t residentBytes(const sf::Texture& texture, size_t) {
+        return static_cast<size_t>(texture.getSize().x) * texture.getSize().y * 4;
+    }
+
+    size_t residentBytes(const sf::SoundBuffer& buffer, size_t) {
+        return static_cast<size_t>(buffer.getSampleCount()) * sizeof(sf::Int16);
+    }
+
+    size_t residentBytes(const sf::Font&, size_t fileBytes) {
+        return fileBytes;   // FreeType reads the face from the file; glyph pages are not counted
+    }
+
+    template <typename Map>
+    size_t evictFrom(Map& slots, const char* kind) {
+        size_t released = 0;
+        for (auto it = slots.begin(); it != slots.end();) {
+            if (it->second.resource.use_count() == 1) {
+                size_t bytes = residentBytes(*it->second.resource, it->second.fileBytes);
+                std::cout << "Evicted " << kind << " " << it->first << " (" << bytes / 1024 << " KB)\n";
+                released += bytes;
+                it = slots.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+        return released;
+    }
+
+    template <typename Map>
+    size_t totalBytes(const Map& slots) {
+        size_t total = 0;
+        for (const auto& entry : slots)
+            total += residentBytes(*entry.second.resource, entry.second.fileBytes);
+        return total;
+    }
+
+    template <typename Map>
+    void reportSlots(std::ostream& out, const Map& slots, const char* kind) {
+        for (const auto& entry : slots) {
+            // One reference is the cache's own
+            out << "  " << kind << " " << entry.first
+                << ": " << residentBytes(*entry.second.resource, entry.second.fileBytes) / 1024 << " KB, "
+                << entry.second.resource.use_count() - 1 << " users\n";
+        }
+    }
+}
+
+std::shared_ptr<sf::Font> ResourceCache::getFont(const std::string& path) {
+    auto it = fonts.find(path);
+    if (it != fonts.end()) return it->second.resource;
+
+    Slot<sf::Font>& slot = fonts[path];
+    slot.resource = std::make_shared<sf::Font>();
+    if (!slot.resource->loadFromFile(path)) {
+        std::cerr << "Error loading font " << path << "!\n";
+    }
+    slot.fileBytes = fileSize(path);
+    return slot.resource;
+}
+
+std::shared_ptr<sf::SoundBuffer> ResourceCache::getSoundBuffer(const std::string& path) {
+    auto it = soundBuffers.find(path);
+    if (it != soundBuffers.end()) return it->second.resource;
+
+    Slot<sf::SoundBuffer>& slot = soundBuffers[path];
+    slot.resource = std::make_shared<sf::SoundBuffer>();
+    if (!slot.resource->loadFromFile(path)) {
+        std::cerr << "Error loading sound " << path << "!\n";
+    }
+    return slot.resource;
+}
+
+std::shared_ptr<sf::Texture> ResourceCache::getTexture(const std::string& path, AssetLoader* loader, bool smooth) {
+    auto it = textures.find(path);
+    if (it != textures.end()) return it->second.resource;
+
+    Slot<sf::Texture>& slot = textures[path];
+    slot.resource = std::make_shared<sf::Texture>();
+    if (loader) {
+        loader->addTexture(path, *slot.resource, smooth);
+    }
+    else {
+        if (!slot.resource->loadFromFile(path)) {
+            std::cerr << "Error loading texture " << path << "!\n";
+        }
+        slot.resource->setSmooth(smooth);
+    }
+    return slot.resource;
+}
+
+size_t ResourceCache::evictUnused() {
+    return evictFrom(fonts, "font") + evictFrom(textures, "texture") + evictFrom(soundBuffers, "sound");
+}
+
+size_t ResourceCache::getResidentBytes() const {
+    return totalBytes(fonts) + totalBytes(textures) + totalBytes(soundBuffers);
+}
+
+void ResourceCache::report(std::ostream& out) const {
+    out << "Resident assets: " << getResidentBytes() / 1024 << " KB\n";
+    reportSlots(out, fonts, "font");
+    reportSlots(out, textures, "texture");
+    reportSlots(out, soundBuffers, "sound");
+}
@@ -0,0 +1,42 @@
+#ifndef RESOURCECACHE_HPP
+#define RESOURCECACHE_HPP
+
+#include <SFML/Graphics.hpp>
+#include <SFML/Audio.hpp>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include "AssetLoader.hpp"
+
+// Fonts, textures and sound buffers keyed by path. Every caller asking for the same path gets
+// a handle to the same object, so each file is loaded once. The cache keeps its own reference;
+// evictUnused() drops the entries nobody else holds any more.
+class ResourceCache {
+public:
+    std::shared_ptr<sf::Font> getFont(const std::string& path);
+    std::shared_ptr<sf::SoundBuffer> getSoundBuffer(const std::string& path);
+
+    // With a loader the texture is returned empty and filled in once the loader uploads it.
+    // Do not evict while such a load is still pending.
+    std::shared_ptr<sf::Texture> getTexture(const std::string& path, AssetLoader* loader = nullptr, bool smooth = false);
+
+    // Returns the number of bytes released
+    size_t evictUnused();
+
+    size_t getResidentBytes() const;
+    void report(std::ostream& out) const;
+
+private:
+    template <typename T>
+    struct Slot {
+        std::shared_ptr<T> resource;
+        size_t fileBytes = 0;
+    };
+
+    std::map<std::string, Slot<sf::Font>> fonts;
+    std::map<std::string, Slot<sf::Texture>> textures;
+    std::map<std::string, Slot<sf::SoundBuffer>> soundBuffers;
+};
+
+#endif // RESOURCECACHE_HPP
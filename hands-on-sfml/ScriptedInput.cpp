@@ -0,0 +1,20 @@
+#include "ScriptedInput.hpp"
+
+ScriptedInput::ScriptedInput(int ticksPerLeg) : ticksPerLeg(ticksPerLeg > 0 ? ticksPerLeg : 1) {}
+
+InputState ScriptedInput::sample() {
+    InputState input;
+
+    switch ((tick / ticksPerLeg) % 4) {
+    case 0: input.right = true; break;
+    case 1: input.down = true; break;
+    case 2: input.left = true; break;
+    case 3: input.up = true; break;
+    }
+
+    input.turnRight = true;
+    input.fire = true;
+
+    tick++;
+    return input;
+}
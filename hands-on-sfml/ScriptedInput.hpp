@@ -0,0 +1,20 @@
+#ifndef SCRIPTEDINPUT_HPP
+#define SCRIPTEDINPUT_HPP
+
+#include "InputSource.hpp"
+
+// Deterministic stand-in for a player: walks a square, sweeps its aim and keeps firing.
+// The pattern depends only on the tick count, so two runs with the same seed match exactly.
+class ScriptedInput : public InputSource {
+public:
+    explicit ScriptedInput(int ticksPerLeg);
+
+    InputState sample() override;
+    void reset() { tick = 0; }
+
+private:
+    int ticksPerLeg;
+    int tick = 0;
+};
+
+#endif // SCRIPTEDINPUT_HPP
@@ -0,0 +1,273 @@
+#include "Simulation.hpp"
+#include "Profiler.hpp"
+#include "ProjectileSystem.hpp"
+#include <algorithm>
+
+Simulation::Simulation(unsigned int seed, float worldSize)
+    : world(worldSize, CHUNK_SIZE, ACTIVE_CHUNK_RADIUS, seed),
+    flowField(world.getActiveArea(), FLOW_FIELD_CELL_SIZE), seed(seed), rng(seed),
+    zombieGrid(world.getActiveArea(), COLLISION_CELL_SIZE) {}
+
+void Simulation::setObstacles(const std::vector<sf::FloatRect>& bounds) {
+    world.setPlacedObstacles(bounds);
+    world.restart();
+    refreshObstacles();
+}
+
+void Simulation::refreshObstacles() {
+    // Obstacles only change when the active window moves, so their bounds are indexed then
+    staticWorld.build(world.getActiveObstacles());
+    flowField.setObstacles(world.getActiveObstacles(), store.zombies.extent);
+}
+
+void Simulation::setZombieSpawnInterval(float seconds) {
+    if (seconds > 0) {
+        zombieSpawnInterval = seconds;
+    }
+}
+
+void Simulation::reset() {
+    zombiesKilled = 0;
+    store.clear();
+    player.health = PLAYER_MAX_HEALTH;
+    player.position = sf::Vector2f(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2);
+    player.storePreviousState();
+    spawnTimer = 0.0f;
+    powerUpSpawnTimer = 0.0f;
+    fireCooldown = 0.0f;
+    world.restart();
+    refreshObstacles();
+}
+
+void Simulation::step(float deltaTime, const InputState& input) {
+    // Snapshot last tick's transforms for render interpolation
+    player.storePreviousState();
+    store.storePreviousState();
+
+    player.move(deltaTime, input, staticWorld, world.getActiveBounds());
+    sf::Vector2f shift;
+    if (world.recentre(player.position, shift)) {
+        rebase(shift);
+    }
+    player.updateBoosts(deltaTime);
+    fire(deltaTime, input.fire);
+    spawnPowerUp(deltaTime);
+    checkPowerUpCollisions();
+
+    // Update bullets; leaving the active area culls them like leaving the world used to
+    updateProjectiles(store.bullets, deltaTime, world.getActiveBounds());
+    updateProjectiles(store.zombieBullets, deltaTime, world.getActiveBounds());
+
+    // Only re-solved when the player crosses into another cell
+    flowField.update(player.position);
+    updateZombies(store.zombies, deltaTime, player.position, store.zombieBullets, staticWorld, flowField, zombieWorkspace);
+
+    checkCollisions();
+    spawnZombies(deltaTime);
+}
+
+void Simulation::rebase(sf::Vector2f shift) {
+    PROFILE_SCOPE("rebase");
+    auto shiftAll = [shift](std::vector<sf::Vector2f>& positions) {
+        for (auto& position : positions) position += shift;
+    };
+    player.position += shift;
+    player.previousPosition += shift;
+    shiftAll(store.bullets.position);
+    shiftAll(store.bullets.previousPosition);
+    shiftAll(store.zombieBullets.position);
+    shiftAll(store.zombieBullets.previousPosition);
+    shiftAll(store.zombies.position);
+    shiftAll(store.zombies.previousPosition);
+    shiftAll(store.powerUps.position);
+
+    // Zombies and power-ups that fell out of the window wait in their chunk; bullets are culled
+    // by updateProjectiles as usual
+    const sf::FloatRect& active = world.getActiveBounds();
+    ZombieArchetype& zombies = store.zombies;
+    for (size_t i = 0; i < zombies.size(); ++i) {
+        if (active.contains(zombies.position[i])) continue;
+        world.parkZombie(ChunkWorld::DormantZombie{ zombies.position[i], zombies.rotation[i], zombies.health[i],
+            zombies.fireTimer[i], zombies.fireInterval[i], zombies.randomState[i] });
+        zombies.health[i] = 0;
+    }
+    zombies.removeDead();
+
+    PowerUpArchetype& powerUps = store.powerUps;
+    for (size_t i = 0; i < powerUps.size();) {
+        if (active.contains(powerUps.position[i])) {
+            ++i;
+            continue;
+        }
+        world.parkPowerUp(ChunkWorld::DormantPowerUp{ powerUps.position[i], powerUps.type[i] });
+        powerUps.remove(i);
+    }
+
+    std::vector<ChunkWorld::DormantZombie> wokenZombies;
+    std::vector<ChunkWorld::DormantPowerUp> wokenPowerUps;
+    world.takeActiveDormant(wokenZombies, wokenPowerUps);
+    for (const auto& dormant : wokenZombies) {
+        zombies.add(dormant.position, dormant.fireInterval, dormant.randomState);
+        zombies.rotation.back() = dormant.rotation;
+        zombies.previousRotation.back() = dormant.rotation;
+        zombies.health.back() = dormant.health;
+        zombies.fireTimer.back() = dormant.fireTimer;
+    }
+    for (const auto& dormant : wokenPowerUps)
+        powerUps.add(dormant.position, dormant.type);
+
+    refreshObstacles();
+}
+
+sf::Vector2f Simulation::spawnOrigin() const {
+    // The fixed map spawns over its first screen; a streamed world around the middle of the window
+    if (!world.isStreaming()) return sf::Vector2f(0, 0);
+    const sf::FloatRect& active = world.getActiveBounds();
+    return sf::Vector2f(std::max(0.0f, (active.width - WINDOW_WIDTH) / 2), std::max(0.0f, (active.height - WINDOW_HEIGHT) / 2));
+}
+
+uint64_t Simulation::hashEntities(const Player& player, const EntityStore& store) {
+    uint64_t hash = 1469598103934665603ull;
+    auto mix = [&hash](const void* data, size_t bytes) {
+        const unsigned char* p = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < bytes; ++i) {
+            hash ^= p[i];
+            hash *= 1099511628211ull;
+        }
+    };
+    auto mixPositions = [&mix](const std::vector<sf::Vector2f>& positions) {
+        if (!positions.empty()) mix(positions.data(), positions.size() * sizeof(sf::Vector2f));
+    };
+
+    mix(&player.position, sizeof(player.position));
+    mix(&player.health, sizeof(player.health));
+    mixPositions(store.bullets.position);
+    mixPositions(store.zombieBullets.position);
+    mixPositions(store.zombies.position);
+    mixPositions(store.powerUps.position);
+    return hash;
+}
+
+void Simulation::fire(float deltaTime, bool held) {
+    // Holding fire shoots at a fixed rate, independent of the tick rate
+    fireCooldown = std::max(0.0f, fireCooldown - deltaTime);
+    if (held && fireCooldown <= 0.0f) {
+        store.bullets.add(player.position, player.getDirection() * BULLET_SPEED * 0.6f, PROJECTILE_TTL, TextureId::Bullet);
+        fireCooldown = PLAYER_FIRE_INTERVAL;
+    }
+}
+
+void Simulation::spawnZombies(float deltaTime) {
+    PROFILE_SCOPE("spawning");
+    spawnTimer += deltaTime;
+    if (spawnTimer > zombieSpawnInterval) {
+        sf::Vector2f spawnPosition(static_cast<float>(rng() % WINDOW_WIDTH), static_cast<float>(rng() % WINDOW_HEIGHT));
+        spawnPosition += spawnOrigin();
+
+        // Ensure zombies don't spawn inside obstacles
+        bool validSpawn = !staticWorld.overlaps(sf::FloatRect(spawnPosition.x, spawnPosition.y, 40, 40));
+
+        if (validSpawn) {
+            spawnZombie(store.zombies, spawnPosition, rng);
+        }
+
+        spawnTimer = 0.0f;
+    }
+}
+
+void Simulation::spawnPowerUp(float deltaTime) {
+    PROFILE_SCOPE("spawning");
+    powerUpSpawnTimer += deltaTime;
+    if (powerUpSpawnTimer > POWERUP_SPAWN_INTERVAL) {
+        sf::Vector2f spawnPosition(static_cast<float>(rng() % WINDOW_WIDTH), static_cast<float>(rng() % WINDOW_HEIGHT));
+        spawnPosition += spawnOrigin();
+        int randomType = rng() % 3;
+
+        store.powerUps.add(spawnPosition, static_cast<PowerUp::Type>(randomType));
+        powerUpSpawnTimer = 0.0f;
+    }
+}
+
+void Simulation::checkPowerUpCollisions() {
+    PROFILE_SCOPE("collisions");
+    PowerUpArchetype& powerUps = store.powerUps;
+    sf::FloatRect playerBounds = player.getBounds();
+
+    for (size_t i = 0; i < powerUps.size();) {
+        if (powerUps.bounds(i).intersects(playerBounds)) {
+            PowerUp::applyEffect(powerUps.type[i], player);
+            powerUps.remove(i);
+        }
+        else {
+            ++i;
+        }
+    }
+}
+
+void Simulation::checkCollisions() {
+    PROFILE_SCOPE("collisions");
+    ProjectilePool& bullets = store.bullets;
+    ProjectilePool& zombieBullets = store.zombieBullets;
+    ZombieArchetype& zombies = store.zombies;
+
+    // Broadphase: bucket zombies once per tick so each bullet only tests its neighbours
+    zombieBounds.clear();
+    zombieBoxes.clear();
+    for (size_t i = 0; i < zombies.size(); ++i) {
+        zombieBounds.push_back(zombies.bounds(i));
+        zombieBoxes.add(zombieBounds.back());
+        if (zombies.health[i] <= 0) zombieBoxes.disable(static_cast<int>(i));
+    }
+    zombieGrid.build(zombieBounds);
+
+    // Expired and out-of-world projectiles were already culled by updateProjectiles;
+    // remove() swaps the last bullet into the current slot, so the index only advances on a miss
+    for (size_t bullet = 0; bullet < bullets.size();) {
+        sf::FloatRect bulletBounds = bullets.bounds(bullet);
+
+        // Check if bullet hits an obstacle
+        if (staticWorld.overlaps(bulletBounds)) {
+            bullets.remove(bullet);
+            continue;
+        }
+
+        // Check if bullet hits a zombie; candidates come back in zombie order so the first hit
+        // matches a full scan. One bullet damages one zombie.
+        zombieGrid.query(bulletBounds, collisionCandidates);
+        int hit = zombieBoxes.firstOverlap(bulletBounds, collisionCandidates);
+        if (hit >= 0) {
+            zombies.health[hit]--;
+            if (zombies.health[hit] <= 0) {
+                zombiesKilled++;
+                zombieBoxes.disable(hit);
+            }
+            bullets.remove(bullet);
+        }
+        else {
+            ++bullet;
+        }
+    }
+
+    // Dead zombies stay in place during the bullet pass so grid indices remain valid
+    zombies.removeDead();
+
+    sf::FloatRect playerBounds = player.getBounds();
+    for (size_t zombieBullet = 0; zombieBullet < zombieBullets.size();) {
+        sf::FloatRect bulletBounds = zombieBullets.bounds(zombieBullet);
+
+        // Check if zombie bullet hits an obstacle
+        if (staticWorld.overlaps(bulletBounds)) {
+            zombieBullets.remove(zombieBullet);
+            continue;
+        }
+
+        // Check if zombie bullet hits player
+        if (bulletBounds.intersects(playerBounds)) {
+            player.health--;
+            zombieBullets.remove(zombieBullet);
+        }
+        else {
+            ++zombieBullet;
+        }
+    }
+}
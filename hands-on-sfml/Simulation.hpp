@@ -0,0 +1,76 @@
+#ifndef SIMULATION_HPP
+#define SIMULATION_HPP
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "ChunkWorld.hpp"
+#include "Constants.hpp"
+#include "EntityStore.hpp"
+#include "FlowField.hpp"
+#include "InputSource.hpp"
+#include "PackedBounds.hpp"
+#include "Player.hpp"
+#include "SpatialGrid.hpp"
+#include "StaticCollisionWorld.hpp"
+#include "ThreadPool.hpp"
+#include "ZombieSystem.hpp"
+
+// Everything that happens in one tick of gameplay, with no window, textures or keyboard.
+// Game feeds it input and draws its state; bench_sim drives it headless with a script.
+// All randomness comes from one engine seeded in the constructor, so a seed and an input
+// sequence always reproduce the same run. Everything works in the world's local coordinates,
+// which shift by whole chunks whenever the active window moves (see ChunkWorld).
+class Simulation {
+public:
+    Player player;
+    EntityStore store;
+    ChunkWorld world;
+    StaticCollisionWorld staticWorld;
+    FlowField flowField;
+    int zombiesKilled = 0;
+
+    explicit Simulation(unsigned int seed, float worldSize = WORLD_SIZE);
+
+    // Call after the zombie extent is set: the flow field is inflated by it. The bounds are the
+    // hand-placed obstacles in world coordinates; generated ones are added per chunk.
+    void setObstacles(const std::vector<sf::FloatRect>& bounds);
+    void setZombieSpawnInterval(float seconds);
+    void setThreadPool(ThreadPool* threads) { zombieWorkspace.threads = threads; }
+    void reset();
+    void step(float deltaTime, const InputState& input);
+    void checkPowerUpCollisions();
+    void checkCollisions();
+
+    bool isPlayerDead() const { return player.health <= 0; }
+    unsigned int getSeed() const { return seed; }
+    float getZombieSpawnInterval() const { return zombieSpawnInterval; }
+
+    // FNV-1a over the player and entity positions: equal hashes mean identical runs
+    uint64_t hashState() const { return hashEntities(player, store); }
+    static uint64_t hashEntities(const Player& player, const EntityStore& store);
+
+private:
+    unsigned int seed;
+    std::mt19937 rng;
+    ZombieWorkspace zombieWorkspace;
+    SpatialGrid zombieGrid;
+    std::vector<sf::FloatRect> zombieBounds;
+    PackedBounds zombieBoxes;   // the same boxes for the narrowphase; dead zombies are disabled
+    std::vector<int> collisionCandidates;
+    float spawnTimer = 0.0f;
+    float zombieSpawnInterval = 3.0f;
+    float powerUpSpawnTimer = 0.0f;
+    float fireCooldown = 0.0f;
+
+    void refreshObstacles();
+    void rebase(sf::Vector2f shift);
+    sf::Vector2f spawnOrigin() const;
+    void fire(float deltaTime, bool held);
+    void spawnZombies(float deltaTime);
+    void spawnPowerUp(float deltaTime);
+};
+
+#endif // SIMULATION_HPP
@@ -0,0 +1,141 @@
+#include "SimulationThread.hpp"
+#include "TraceRecorder.hpp"
+#include <algorithm>
+#include <cassert>
+
+SimulationThread::SimulationThread(Simulation& sim) : sim(sim) {
+}
+
+SimulationThread::~SimulationThread() {
+    stop();
+}
+
+void SimulationThread::setInput(InputSource* source, InputRecorder* inputRecorder, ReplayInput* replayInput) {
+    input = source;
+    recorder = inputRecorder;
+    replay = replayInput;
+}
+
+void SimulationThread::start(bool threaded) {
+    started = true;
+    // The renderer always has a snapshot to draw, even before the first tick
+    publish(0.0f, 0);
+    if (threaded) {
+        worker = std::thread(&SimulationThread::threadLoop, this);
+    }
+}
+
+void SimulationThread::stop() {
+    if (worker.joinable()) {
+        stopping.store(true, std::memory_order_release);
+        worker.join();
+    }
+}
+
+void SimulationThread::advance(float frameSeconds) {
+    // Clamp long frames (window drag, breakpoints) so the sim never tries to catch up forever
+    accumulator += std::min(frameSeconds, MAX_FRAME_TIME);
+    runDueTicks();
+}
+
+void SimulationThread::threadLoop() {
+    TRACE_THREAD_NAME("simulation");
+    Clock::time_point last = Clock::now();
+    while (!stopping.load(std::memory_order_acquire)) {
+        Clock::time_point now = Clock::now();
+        accumulator += std::min(std::chrono::duration<float>(now - last).count(), MAX_FRAME_TIME);
+        last = now;
+        runDueTicks();
+
+        // Sleep until the next tick is due; a fast replay only yields between batches
+        bool flatOut = fastForward && !replayFinished && running.load(std::memory_order_relaxed);
+        if (flatOut) {
+            std::this_thread::yield();
+        }
+        else {
+            float wait = std::max(tickLength - accumulator, 0.0f);
+            std::this_thread::sleep_for(std::chrono::duration<float>(wait));
+        }
+    }
+}
+
+void SimulationThread::runDueTicks() {
+    bool changed = applyRestartRequests();
+    bool active = running.load(std::memory_order_acquire) && !replayFinished;
+    if (active && fastForward) {
+        accumulator = FAST_REPLAY_TICKS_PER_FRAME * tickLength;
+    }
+
+    // Time spent in the menu or paused is dropped, not caught up on afterwards
+    Clock::time_point batchStart = Clock::now();
+    int ticks = 0;
+    while (accumulator >= tickLength) {
+        accumulator -= tickLength;
+        if (!active) continue;
+        if (!step()) {
+            changed = true;
+            break;
+        }
+        ticks++;
+    }
+
+    if (ticks > 0 || changed) {
+        publish(std::chrono::duration<float, std::milli>(Clock::now() - batchStart).count(), ticks);
+    }
+}
+
+bool SimulationThread::applyRestartRequests() {
+    // Several requests between two ticks are still one restart
+    int requests = restartRequests.load(std::memory_order_acquire);
+    if (requests == restartsApplied) return false;
+    restartsApplied = requests;
+
+    if (recorder) recorder->markRestart();
+    sim.reset();
+    restarts++;
+    return true;
+}
+
+bool SimulationThread::step() {
+    if (replay) {
+        if (replay->finished()) {
+            replayFinished = true;
+            return false;
+        }
+        if (replay->restartPending()) {
+            sim.reset();
+            restarts++;
+        }
+    }
+
+    TRACE_SCOPE("tick");
+    sim.step(tickLength, input->sample());
+    tick++;
+    return true;
+}
+
+void SimulationThread::publish(float batchMs, int batchTicks) {
+    WorldSnapshot& snapshot = snapshots.back();
+    snapshot.capture(sim);
+    snapshot.tick = tick;
+    snapshot.restarts = restarts;
+    snapshot.restartRequests = restartsApplied;
+    snapshot.replayFinished = replayFinished;
+    if (replayFinished) snapshot.stateHash = sim.hashState();
+    snapshot.tickMs = batchTicks > 0 ? batchMs / batchTicks : 0.0f;
+    snapshot.carried = accumulator;
+    snapshots.publish();
+}
+
+const WorldSnapshot& SimulationThread::acquire() {
+    if (snapshots.update()) {
+        // Catches a torn copy: the entities must hash to what the simulation held at capture
+        assert(snapshots.front().isConsistent());
+    }
+    return snapshots.front();
+}
+
+float SimulationThread::getAlpha(const WorldSnapshot& snapshot) const {
+    float since = std::chrono::duration<float>(Clock::now() - snapshot.captured).count();
+    return std::min(1.0f, (snapshot.carried + since) / tickLength);
+}
@@ -0,0 +1,81 @@
+#ifndef SIMULATIONTHREAD_HPP
+#define SIMULATIONTHREAD_HPP
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "InputRecorder.hpp"
+#include "InputSource.hpp"
+#include "ReplayInput.hpp"
+#include "Simulation.hpp"
+#include "TripleBuffer.hpp"
+#include "WorldSnapshot.hpp"
+
+// Steps a Simulation at its fixed tick rate and publishes a WorldSnapshot after every batch of
+// ticks. Threaded, the ticks run on a thread of their own, so a slow frame no longer holds the
+// simulation back and a slow tick no longer holds a frame back; inline, advance() runs the
+// ticks that are due on the calling thread, as the main loop used to. Restarts, recording and
+// replay are all handled between ticks on whichever thread simulates, so runs stay tick-exact.
+class SimulationThread {
+public:
+    explicit SimulationThread(Simulation& sim);
+    ~SimulationThread();
+
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+    // Before start(); the recorder and replay may be null
+    void setInput(InputSource* input, InputRecorder* recorder, ReplayInput* replay);
+    void setTickRate(float ticksPerSecond) { tickLength = 1.0f / ticksPerSecond; }
+    // Replays: ticks back to back in batches of FAST_REPLAY_TICKS_PER_FRAME, whatever the clock says
+    void setFastForward(bool enabled) { fastForward = enabled; }
+
+    // Publishes the starting state, then hands the simulation to a new thread if 'threaded'
+    void start(bool threaded);
+    void stop();
+    bool isStarted() const { return started; }
+    bool isThreaded() const { return worker.joinable(); }
+
+    // Main thread. Ticks only run while running (not in the menu or while paused); the
+    // simulation must not be touched directly between start() and stop().
+    void setRunning(bool running) { this->running.store(running, std::memory_order_release); }
+    void requestRestart() { restartRequests.fetch_add(1, std::memory_order_release); }
+    // Inline only: runs the ticks due after another 'frameSeconds' of real time
+    void advance(float frameSeconds);
+    // Takes the newest snapshot, if a new one was published; the reference stays valid until the next call
+    const WorldSnapshot& acquire();
+    // How far past the snapshot's tick 'now' is, in ticks, for interpolating between its two positions
+    float getAlpha(const WorldSnapshot& snapshot) const;
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    Simulation& sim;
+    InputSource* input = nullptr;
+    InputRecorder* recorder = nullptr;
+    ReplayInput* replay = nullptr;
+    float tickLength = 1.0f / SIM_TICK_RATE;
+    bool fastForward = false;
+    bool started = false;
+
+    TripleBuffer<WorldSnapshot> snapshots;
+    std::thread worker;
+    std::atomic<bool> running{ false };
+    std::atomic<bool> stopping{ false };
+    std::atomic<int> restartRequests{ 0 };
+
+    // Only touched by the thread that simulates
+    float accumulator = 0.0f;
+    int restartsApplied = 0;     // requests serviced, reported back so callers can tell theirs went through
+    int restarts = 0;
+    long long tick = 0;
+    bool replayFinished = false;
+
+    void runDueTicks();
+    bool applyRestartRequests();
+    bool step();
+    void publish(float batchMs, int batchTicks);
+    void threadLoop();
+};
+
+#endif // SIMULATIONTHREAD_HPP
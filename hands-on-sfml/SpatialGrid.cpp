@@ -0,0 +1,81 @@
+#include "SpatialGrid.hpp"
+#include <algorithm>
+#include <cmath>
+
+SpatialGrid::SpatialGrid(const sf::FloatRect& worldBounds, float cellSize)
+    : world(worldBounds), cellSize(cellSize) {
+    columns = std::max(1, static_cast<int>(std::ceil(world.width / cellSize)));
+    rows = std::max(1, static_cast<int>(std::ceil(world.height / cellSize)));
+    cellStart.assign(columns * rows + 1, 0);
+}
+
+void SpatialGrid::cellRange(const sf::FloatRect& area, int& minX, int& minY, int& maxX, int& maxY) const {
+    // Anything outside the world is clamped into the border cells
+    minX = static_cast<int>(std::floor((area.left - world.left) / cellSize));
+    minY = static_cast<int>(std::floor((area.top - world.top) / cellSize));
+    maxX = static_cast<int>(std::floor((area.left + area.width - world.left) / cellSize));
+    maxY = static_cast<int>(std::floor((area.top + area.height - world.top) / cellSize));
+
+    minX = std::max(0, std::min(columns - 1, minX));
+    minY = std::max(0, std::min(rows - 1, minY));
+    maxX = std::max(0, std::min(columns - 1, maxX));
+    maxY = std::max(0, std::min(rows - 1, maxY));
+}
+
+void SpatialGrid::build(const std::vector<sf::FloatRect>& bounds) {
+    std::fill(cellStart.begin(), cellStart.end(), 0);
+
+    // Counting sort: count per cell, prefix sum, then scatter
+    for (const auto& rect : bounds) {
+        int minX, minY, maxX, maxY;
+        cellRange(rect, minX, minY, maxX, maxY);
+        for (int y = minY; y <= maxY; ++y)
+            for (int x = minX; x <= maxX; ++x)
+                cellStart[y * columns + x + 1]++;
+    }
+
+    for (size_t c = 1; c < cellStart.size(); ++c)
+        cellStart[c] += cellStart[c - 1];
+
+    entries.resize(cellStart.back());
+    cursor.assign(cellStart.begin(), cellStart.end() - 1);
+
+    for (size_t i = 0; i < bounds.size(); ++i) {
+        int minX, minY, maxX, maxY;
+        cellRange(bounds[i], minX, minY, maxX, maxY);
+        for (int y = minY; y <= maxY; ++y)
+            for (int x = minX; x <= maxX; ++x)
+                entries[cursor[y * columns + x]++] = static_cast<int>(i);
+    }
+
+    lastSeen.assign(bounds.size(), 0);
+    queryStamp = 0;
+}
+
+void SpatialGrid::query(const sf::FloatRect& area, std::vector<int>& result) const {
+    result.clear();
+    if (lastSeen.empty()) return;
+
+    if (++queryStamp == 0) {
+        std::fill(lastSeen.begin(), lastSeen.end(), 0);
+        queryStamp = 1;
+    }
+
+    int minX, minY, maxX, maxY;
+    cellRange(area, minX, minY, maxX, maxY);
+
+    for (int y = minY; y <= maxY; ++y) {
+        for (int x = minX; x <= maxX; ++x) {
+            int cell = y * columns + x;
+            for (int e = cellStart[cell]; e < cellStart[cell + 1]; ++e) {
+                int id = entries[e];
+                if (lastSeen[id] != queryStamp) {
+                    lastSeen[id] = queryStamp;
+                    result.push_back(id);
+                }
+            }
+        }
+    }
+
+    std::sort(result.begin(), result.end());
+}
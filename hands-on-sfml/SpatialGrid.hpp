@@ -0,0 +1,38 @@
+#ifndef SPATIALGRID_HPP
+#define SPATIALGRID_HPP
+
+#include <SFML/Graphics/Rect.hpp>
+#include <vector>
+
+// Uniform grid broadphase over a fixed world rectangle. Rebuilt from a list of
+// bounds each tick; queries return indices into that list, sorted ascending so
+// callers can keep "first match wins" semantics of a plain linear scan.
+class SpatialGrid {
+public:
+    SpatialGrid(const sf::FloatRect& worldBounds, float cellSize);
+
+    void build(const std::vector<sf::FloatRect>& bounds);
+    void query(const sf::FloatRect& area, std::vector<int>& result) const;
+
+    int getColumns() const { return columns; }
+    int getRows() const { return rows; }
+
+private:
+    sf::FloatRect world;
+    float cellSize;
+    int columns;
+    int rows;
+
+    // Cell contents packed back to back: cell c owns entries [cellStart[c], cellStart[c + 1])
+    std::vector<int> cellStart;
+    std::vector<int> entries;
+    std::vector<int> cursor;
+
+    // Per-object stamp used to drop duplicates when an object spans several cells
+    mutable std::vector<unsigned int> lastSeen;
+    mutable unsigned int queryStamp = 0;
+
+    void cellRange(const sf::FloatRect& area, int& minX, int& minY, int& maxX, int& maxY) const;
+};
+
+#endif // SPATIALGRID_HPP
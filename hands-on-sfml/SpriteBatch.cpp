@@ -0,0 +1,86 @@
+#include "SpriteBatch.hpp"
+#include <cstdlib>
+
+void SpriteBatch::begin(const sf::FloatRect& visible) {
+    begin();
+    cullRect = visible;
+    culling = true;
+}
+
+void SpriteBatch::begin() {
+    for (size_t i = 0; i < activeBatches; ++i)
+        batches[i].vertices.clear();
+    activeBatches = 0;
+    culling = false;
+    stats = Stats();
+}
+
+bool SpriteBatch::isVisible(const sf::FloatRect& bounds) {
+    // Edges touching counts as visible, so nothing pops at the border of the view
+    if (!culling || (bounds.left <= cullRect.left + cullRect.width && bounds.left + bounds.width >= cullRect.left &&
+        bounds.top <= cullRect.top + cullRect.height && bounds.top + bounds.height >= cullRect.top)) {
+        return true;
+    }
+    stats.culled++;
+    return false;
+}
+
+sf::VertexArray& SpriteBatch::batchFor(const sf::Texture* texture) {
+    // A handful of textures per frame, so a linear search beats hashing
+    for (size_t i = 0; i < activeBatches; ++i)
+        if (batches[i].texture == texture) return batches[i].vertices;
+
+    if (activeBatches == batches.size())
+        batches.push_back(Batch{ nullptr, sf::VertexArray(sf::Triangles) });
+
+    Batch& batch = batches[activeBatches++];
+    batch.texture = texture;
+    batch.vertices.clear();
+    return batch.vertices;
+}
+
+void SpriteBatch::draw(const sf::Sprite& sprite) {
+    const sf::Texture* texture = sprite.getTexture();
+    if (!texture) return;
+
+    const sf::IntRect& rect = sprite.getTextureRect();
+    const sf::Transform& transform = sprite.getTransform();
+    sf::Color color = sprite.getColor();
+
+    // Same corners and texture coordinates sf::Sprite builds for itself
+    float width = static_cast<float>(std::abs(rect.width));
+    float height = static_cast<float>(std::abs(rect.height));
+    float left = static_cast<float>(rect.left);
+    float right = left + rect.width;
+    float top = static_cast<float>(rect.top);
+    float bottom = top + rect.height;
+
+    sf::Vertex topLeft(transform.transformPoint(0, 0), color, sf::Vector2f(left, top));
+    sf::Vertex bottomLeft(transform.transformPoint(0, height), color, sf::Vector2f(left, bottom));
+    sf::Vertex topRight(transform.transformPoint(width, 0), color, sf::Vector2f(right, top));
+    sf::Vertex bottomRight(transform.transformPoint(width, height), color, sf::Vector2f(right, bottom));
+
+    sf::VertexArray& vertices = batchFor(texture);
+    vertices.append(topLeft);
+    vertices.append(bottomLeft);
+    vertices.append(topRight);
+    vertices.append(topRight);
+    vertices.append(bottomLeft);
+    vertices.append(bottomRight);
+
+    stats.sprites++;
+}
+
+void SpriteBatch::end(sf::RenderTarget& target, const sf::RenderStates& states) {
+    for (size_t i = 0; i < activeBatches; ++i) {
+        const Batch& batch = batches[i];
+        if (batch.vertices.getVertexCount() == 0) continue;
+
+        sf::RenderStates batchStates(states);
+        batchStates.texture = batch.texture;
+        target.draw(batch.vertices, batchStates);
+
+        stats.drawCalls++;
+        stats.vertices += static_cast<unsigned int>(batch.vertices.getVertexCount());
+    }
+}
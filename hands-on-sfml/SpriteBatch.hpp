@@ -0,0 +1,49 @@
+#ifndef SPRITEBATCH_HPP
+#define SPRITEBATCH_HPP
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+// Collects sprites into one triangle list per texture and submits each list with a single
+// draw call. Batches are flushed in the order their texture was first used this frame, so
+// layering between textures follows submission order; within a texture it is exact.
+// Callers test entities against the cull rectangle before building a sprite for them, so
+// off-screen entities cost one rectangle test and nothing else.
+class SpriteBatch {
+public:
+    struct Stats {
+        unsigned int sprites = 0;    // submitted to the GPU
+        unsigned int culled = 0;     // rejected by the cull rectangle
+        unsigned int drawCalls = 0;
+        unsigned int vertices = 0;
+    };
+
+    // 'visible' is the world area the target shows; anything outside it is culled
+    void begin(const sf::FloatRect& visible);
+    void begin();
+    // True if 'bounds' can be seen; otherwise counts it as culled
+    bool isVisible(const sf::FloatRect& bounds);
+    void addCulled(unsigned int count) { stats.culled += count; }
+    const sf::FloatRect& getCullRect() const { return cullRect; }
+    void draw(const sf::Sprite& sprite);
+    void end(sf::RenderTarget& target, const sf::RenderStates& states = sf::RenderStates::Default);
+
+    const Stats& getStats() const { return stats; }
+
+private:
+    struct Batch {
+        const sf::Texture* texture;
+        sf::VertexArray vertices;
+    };
+
+    // Vertex arrays are kept between frames so their storage is reused
+    std::vector<Batch> batches;
+    size_t activeBatches = 0;
+    sf::FloatRect cullRect;
+    bool culling = false;
+    Stats stats;
+
+    sf::VertexArray& batchFor(const sf::Texture* texture);
+};
+
+#endif // SPRITEBATCH_HPP
@@ -0,0 +1,154 @@
+#include "StaticCollisionWorld.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    bool boxesOverlap(const sf::FloatRect& a, float minX, float minY, float maxX, float maxY) {
+        // Strict comparisons to match sf::FloatRect::intersects, where touching edges do not count
+        return a.left < maxX && a.left + a.width > minX && a.top < maxY && a.top + a.height > minY;
+    }
+
+    bool segmentHitsBox(sf::Vector2f from, sf::Vector2f delta, float minX, float minY, float maxX, float maxY) {
+        // Slab test against the segment from + t * delta, t in [0, 1]
+        float tMin = 0.0f, tMax = 1.0f;
+        const float origin[2] = { from.x, from.y };
+        const float dir[2] = { delta.x, delta.y };
+        const float lo[2] = { minX, minY };
+        const float hi[2] = { maxX, maxY };
+
+        for (int axis = 0; axis < 2; ++axis) {
+            if (std::abs(dir[axis]) < 1e-8f) {
+                if (origin[axis] < lo[axis] || origin[axis] > hi[axis]) return false;
+                continue;
+            }
+            float t1 = (lo[axis] - origin[axis]) / dir[axis];
+            float t2 = (hi[axis] - origin[axis]) / dir[axis];
+            if (t1 > t2) std::swap(t1, t2);
+            tMin = std::max(tMin, t1);
+            tMax = std::min(tMax, t2);
+            if (tMin > tMax) return false;
+        }
+        return true;
+    }
+}
+
+void StaticCollisionWorld::build(const std::vector<sf::FloatRect>& newBounds) {
+    bounds = newBounds;
+    order.resize(bounds.size());
+    for (size_t i = 0; i < order.size(); ++i) order[i] = static_cast<int>(i);
+
+    nodes.clear();
+    nodes.reserve(bounds.size() * 2);
+    if (!bounds.empty()) buildNode(0, static_cast<int>(bounds.size()));
+}
+
+int StaticCollisionWorld::buildNode(int first, int count) {
+    int index = static_cast<int>(nodes.size());
+    nodes.emplace_back();
+
+    Node node;
+    node.minX = node.minY = INFINITY;
+    node.maxX = node.maxY = -INFINITY;
+    for (int i = first; i < first + count; ++i) {
+        const sf::FloatRect& b = bounds[order[i]];
+        node.minX = std::min(node.minX, b.left);
+        node.minY = std::min(node.minY, b.top);
+        node.maxX = std::max(node.maxX, b.left + b.width);
+        node.maxY = std::max(node.maxY, b.top + b.height);
+    }
+
+    if (count <= LEAF_SIZE) {
+        node.first = first;
+        node.count = count;
+        nodes[index] = node;
+        return index;
+    }
+
+    // Median split on the longer axis of the node box
+    bool splitX = (node.maxX - node.minX) >= (node.maxY - node.minY);
+    auto centre = [&](int id) {
+        const sf::FloatRect& b = bounds[id];
+        return splitX ? b.left + b.width / 2 : b.top + b.height / 2;
+    };
+    int half = count / 2;
+    std::nth_element(order.begin() + first, order.begin() + first + half, order.begin() + first + count,
+        [&](int a, int b) { return centre(a) < centre(b); });
+
+    node.left = buildNode(first, half);
+    node.right = buildNode(first + half, count - half);
+    nodes[index] = node;
+    return index;
+}
+
+bool StaticCollisionWorld::overlaps(const sf::FloatRect& area) const {
+    if (nodes.empty()) return false;
+
+    int stack[64];
+    int top = 0;
+    stack[top++] = 0;
+
+    while (top > 0) {
+        const Node& node = nodes[stack[--top]];
+        if (!boxesOverlap(area, node.minX, node.minY, node.maxX, node.maxY)) continue;
+
+        if (node.left < 0) {
+            for (int i = node.first; i < node.first + node.count; ++i)
+                if (area.intersects(bounds[order[i]])) return true;
+        }
+        else {
+            stack[top++] = node.left;
+            stack[top++] = node.right;
+        }
+    }
+    return false;
+}
+
+void StaticCollisionWorld::query(const sf::FloatRect& area, std::vector<int>& result) const {
+    result.clear();
+    if (nodes.empty()) return;
+
+    int stack[64];
+    int top = 0;
+    stack[top++] = 0;
+
+    while (top > 0) {
+        const Node& node = nodes[stack[--top]];
+        if (!boxesOverlap(area, node.minX, node.minY, node.maxX, node.maxY)) continue;
+
+        if (node.left < 0) {
+            for (int i = node.first; i < node.first + node.count; ++i)
+                if (area.intersects(bounds[order[i]])) result.push_back(order[i]);
+        }
+        else {
+            stack[top++] = node.left;
+            stack[top++] = node.right;
+        }
+    }
+    std::sort(result.begin(), result.end());
+}
+
+bool StaticCollisionWorld::segmentIntersects(sf::Vector2f from, sf::Vector2f to) const {
+    if (nodes.empty()) return false;
+
+    sf::Vector2f delta = to - from;
+    int stack[64];
+    int top = 0;
+    stack[top++] = 0;
+
+    while (top > 0) {
+        const Node& node = nodes[stack[--top]];
+        if (!segmentHitsBox(from, delta, node.minX, node.minY, node.maxX, node.maxY)) continue;
+
+        if (node.left < 0) {
+            for (int i = node.first; i < node.first + node.count; ++i) {
+                const sf::FloatRect& b = bounds[order[i]];
+                if (segmentHitsBox(from, delta, b.left, b.top, b.left + b.width, b.top + b.height)) return true;
+            }
+        }
+        else {
+            stack[top++] = node.left;
+            stack[top++] = node.right;
+        }
+    }
+    return false;
+}
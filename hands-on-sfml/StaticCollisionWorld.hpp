@@ -0,0 +1,39 @@
+#ifndef STATICCOLLISIONWORLD_HPP
+#define STATICCOLLISIONWORLD_HPP
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <vector>
+
+// Bounding volume tree over geometry that never moves after the level is built.
+// Takes plain bounds so the simulation can build it without any sprites or textures.
+class StaticCollisionWorld {
+public:
+    void build(const std::vector<sf::FloatRect>& bounds);
+
+    bool overlaps(const sf::FloatRect& area) const;
+    void query(const sf::FloatRect& area, std::vector<int>& result) const;
+    bool segmentIntersects(sf::Vector2f from, sf::Vector2f to) const;
+
+    const sf::FloatRect& getBounds(int index) const { return bounds[index]; }
+    size_t size() const { return bounds.size(); }
+
+private:
+    struct Node {
+        float minX, minY, maxX, maxY;
+        int left = -1;    // child node, or -1 for a leaf
+        int right = -1;
+        int first = 0;    // leaf range into 'order'
+        int count = 0;
+    };
+
+    static constexpr int LEAF_SIZE = 4;
+
+    std::vector<sf::FloatRect> bounds;
+    std::vector<int> order;
+    std::vector<Node> nodes;
+
+    int buildNode(int first, int count);
+};
+
+#endif // STATICCOLLISIONWORLD_HPP
@@ -0,0 +1,314 @@
+#include "TextureAtlas.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace {
+    // Each image is extruded by one pixel and separated by another, so linear filtering
+    // at sprite edges samples the sprite's own border instead of its neighbour
+    constexpr int EXTRUDE = 1;
+    constexpr int GAP = 1;
+
+    class SkylinePacker {
+    public:
+        explicit SkylinePacker(int size) : size(size) {
+            skyline.push_back({ 0, 0, size });
+        }
+
+        bool insert(int width, int height, sf::Vector2i& position) {
+            int bestIndex = -1, bestY = size, bestWidth = size;
+
+            for (size_t i = 0; i < skyline.size(); ++i) {
+                int y;
+                if (!fits(i, width, height, y)) continue;
+                if (y < bestY || (y == bestY && skyline[i].width < bestWidth)) {
+                    bestIndex = static_cast<int>(i);
+                    bestY = y;
+                    bestWidth = skyline[i].width;
+                }
+            }
+            if (bestIndex < 0) return false;
+
+            position = sf::Vector2i(skyline[bestIndex].x, bestY);
+            place(bestIndex, position.x, bestY + height, width);
+            usedHeight = std::max(usedHeight, bestY + height);
+            return true;
+        }
+
+        int getUsedHeight() const { return usedHeight; }
+
+    private:
+        struct Segment { int x, y, width; };
+
+        int size;
+        int usedHeight = 0;
+        std::vector<Segment> skyline;
+
+        bool fits(size_t index, int width, int height, int& y) const {
+            if (skyline[index].x + width > size) return false;
+
+            // Resting height is the tallest segment the rectangle spans
+            y = 0;
+            int remaining = width;
+            for (size_t i = index; remaining > 0; ++i) {
+                if (i >= skyline.size()) return false;
+                y = std::max(y, skyline[i].y);
+                if (y + height > size) return false;
+                remaining -= skyline[i].width;
+            }
+            return true;
+        }
+
+        void place(int index, int x, int top, int width) {
+            skyline.insert(skyline.begin() + index, { x, top, width });
+
+            // Trim or remove the segments now hidden under the new one
+            for (size_t i = index + 1; i < skyline.size();) {
+                Segment& previous = skyline[i - 1];
+                Segment& current = skyline[i];
+                int overlap = previous.x + previous.width - current.x;
+                if (overlap <= 0) break;
+
+                current.x += overlap;
+                current.width -= overlap;
+                if (current.width > 0) break;
+                skyline.erase(skyline.begin() + i);
+            }
+
+            // Merge neighbours at the same height
+            for (size_t i = 0; i + 1 < skyline.size();) {
+                if (skyline[i].y == skyline[i + 1].y) {
+                    skyline[i].width += skyline[i + 1].width;
+                    skyline.erase(skyline.begin() + i + 1);
+                }
+                else {
+                    ++i;
+                }
+            }
+        }
+    };
+
+    void blitExtruded(sf::Image& page, const sf::Image& image, int x, int y) {
+        sf::Vector2u size = image.getSize();
+        int width = static_cast<int>(size.x), height = static_cast<int>(size.y);
+
+        page.copy(image, x + EXTRUDE, y + EXTRUDE);
+
+        // Duplicate the outer rows and columns (corners included) into the extrude border
+        page.copy(image, x + EXTRUDE, y, sf::IntRect(0, 0, width, 1));
+        page.copy(image, x + EXTRUDE, y + EXTRUDE + height, sf::IntRect(0, height - 1, width, 1));
+        for (int row = -EXTRUDE; row < height + EXTRUDE; ++row) {
+            int sourceRow = std::max(0, std::min(height - 1, row));
+            page.setPixel(x, y + EXTRUDE + row, image.getPixel(0, sourceRow));
+            page.setPixel(x + EXTRUDE + width, y + EXTRUDE + row, image.getPixel(width - 1, sourceRow));
+        }
+    }
+
+    // Size and FNV-1a hash of the file's bytes; a size of -1 if it cannot be read
+    struct Fingerprint {
+        long long size = -1;
+        unsigned long long hash = 0;
+    };
+
+    Fingerprint fingerprint(const std::string& path) {
+        Fingerprint result;
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) return result;
+
+        result.size = 0;
+        result.hash = 1469598103934665603ull;
+        char buffer[4096];
+        while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0) {
+            std::streamsize count = file.gcount();
+            for (std::streamsize i = 0; i < count; ++i) {
+                result.hash ^= static_cast<unsigned char>(buffer[i]);
+                result.hash *= 1099511628211ull;
+            }
+            result.size += count;
+        }
+        return result;
+    }
+}
+
+TextureAtlas::TextureAtlas(unsigned int pageSize) : pageSize(pageSize) {}
+
+void TextureAtlas::add(const std::string& name, const std::string& path) {
+    sources.push_back({ name, path });
+}
+
+bool TextureAtlas::contains(const std::string& name) const {
+    return regions.find(name) != regions.end();
+}
+
+const TextureAtlas::Region& TextureAtlas::get(const std::string& name) const {
+    static const Region missing;
+    auto it = regions.find(name);
+    if (it == regions.end()) {
+        std::cerr << "Texture atlas has no region named " << name << "\n";
+        return missing;
+    }
+    return it->second;
+}
+
+const sf::Texture& TextureAtlas::getPage(int page) const {
+    if (page < 0 || page >= static_cast<int>(pages.size())) {
+        static const sf::Texture missing;
+        std::cerr << "Error: texture atlas has no page " << page << "!\n";
+        return missing;
+    }
+    return *pages[page];
+}
+
+bool TextureAtlas::build(const std::string& cachePrefix) {
+    bool complete = prepare(cachePrefix);
+    return upload() && complete;
+}
+
+bool TextureAtlas::prepare(const std::string& cachePrefix) {
+    pendingPages.clear();
+    loadedFromCache = !cachePrefix.empty() && loadCache(cachePrefix, pendingPages);
+    if (loadedFromCache) return true;
+
+    // A missing image still leaves the others usable, but only a complete atlas is cached
+    pendingPages.clear();
+    bool complete = pack(pendingPages);
+    if (complete && !cachePrefix.empty()) saveCache(cachePrefix, pendingPages);
+    return complete;
+}
+
+bool TextureAtlas::pack(std::vector<sf::Image>& pageImages) {
+    std::vector<sf::Image> images(sources.size());
+    bool ok = true;
+    for (size_t i = 0; i < sources.size(); ++i) {
+        if (!images[i].loadFromFile(sources[i].path)) {
+            std::cerr << "Error loading atlas image " << sources[i].path << "\n";
+            ok = false;
+        }
+    }
+
+    // Tallest first keeps the skyline flat
+    std::vector<size_t> order(sources.size());
+    for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return images[a].getSize().y > images[b].getSize().y;
+    });
+
+    int size = static_cast<int>(pageSize);
+    std::vector<SkylinePacker> packers;
+    std::vector<sf::Vector2i> positions(sources.size());
+    std::vector<int> pageOf(sources.size(), -1);
+
+    for (size_t index : order) {
+        sf::Vector2u imageSize = images[index].getSize();
+        if (imageSize.x == 0 || imageSize.y == 0) continue;
+
+        int slotWidth = static_cast<int>(imageSize.x) + 2 * EXTRUDE + GAP;
+        int slotHeight = static_cast<int>(imageSize.y) + 2 * EXTRUDE + GAP;
+        if (slotWidth > size || slotHeight > size) {
+            std::cerr << "Atlas image " << sources[index].path << " does not fit in a " << size << " page\n";
+            ok = false;
+            continue;
+        }
+
+        size_t page = 0;
+        for (; page < packers.size(); ++page)
+            if (packers[page].insert(slotWidth, slotHeight, positions[index])) break;
+        if (page == packers.size()) {
+            packers.emplace_back(size);
+            packers.back().insert(slotWidth, slotHeight, positions[index]);
+        }
+        pageOf[index] = static_cast<int>(page);
+    }
+
+    // Pages are cropped to the height actually used
+    pageImages.resize(packers.size());
+    for (size_t page = 0; page < packers.size(); ++page)
+        pageImages[page].create(pageSize, static_cast<unsigned int>(packers[page].getUsedHeight()), sf::Color::Transparent);
+
+    regions.clear();
+    for (size_t i = 0; i < sources.size(); ++i) {
+        if (pageOf[i] < 0) continue;
+        blitExtruded(pageImages[pageOf[i]], images[i], positions[i].x, positions[i].y);
+
+        Region region;
+        region.page = pageOf[i];
+        region.rect = sf::IntRect(positions[i].x + EXTRUDE, positions[i].y + EXTRUDE,
+            static_cast<int>(images[i].getSize().x), static_cast<int>(images[i].getSize().y));
+        regions[sources[i].name] = region;
+    }
+
+    return ok;
+}
+
+bool TextureAtlas::upload() {
+    pages.clear();
+    std::vector<sf::Image> pageImages;
+    pageImages.swap(pendingPages);   // the CPU copies are not needed once on the GPU
+
+    for (const auto& image : pageImages) {
+        std::unique_ptr<sf::Texture> texture(new sf::Texture());
+        if (!texture->loadFromImage(image)) {
+            std::cerr << "Error uploading texture atlas page\n";
+            return false;
+        }
+        texture->setSmooth(true);
+        pages.push_back(std::move(texture));
+    }
+    return true;
+}
+
+bool TextureAtlas::loadCache(const std::string& cachePrefix, std::vector<sf::Image>& pageImages) {
+    std::ifstream index(cachePrefix + ".atlas");
+    if (!index.is_open()) return false;
+
+    // Header: page count, then one line per source with its size and hash when the cache was written
+    size_t pageCount = 0, sourceCount = 0;
+    if (!(index >> pageCount >> sourceCount) || sourceCount != sources.size()) return false;
+    for (const auto& source : sources) {
+        std::string name;
+        Fingerprint cached;
+        if (!(index >> name >> cached.size >> cached.hash) || name != source.name) return false;
+        Fingerprint current = fingerprint(source.path);
+        if (cached.size != current.size || cached.hash != current.hash) return false;
+    }
+
+    std::map<std::string, Region> cachedRegions;
+    for (size_t i = 0; i < sourceCount; ++i) {
+        std::string name;
+        Region region;
+        if (!(index >> name >> region.page >> region.rect.left >> region.rect.top >> region.rect.width >> region.rect.height))
+            return false;
+        cachedRegions[name] = region;
+    }
+
+    pageImages.resize(pageCount);
+    for (size_t page = 0; page < pageCount; ++page)
+        if (!pageImages[page].loadFromFile(cachePrefix + "_" + std::to_string(page) + ".png")) return false;
+
+    regions.swap(cachedRegions);
+    return true;
+}
+
+void TextureAtlas::saveCache(const std::string& cachePrefix, const std::vector<sf::Image>& pageImages) const {
+    for (size_t page = 0; page < pageImages.size(); ++page) {
+        if (!pageImages[page].saveToFile(cachePrefix + "_" + std::to_string(page) + ".png")) {
+            std::cerr << "Could not write texture atlas cache\n";
+            return;
+        }
+    }
+
+    std::ofstream index(cachePrefix + ".atlas");
+    if (!index.is_open()) return;
+
+    index << pageImages.size() << " " << sources.size() << "\n";
+    for (const auto& source : sources) {
+        Fingerprint current = fingerprint(source.path);
+        index << source.name << " " << current.size << " " << current.hash << "\n";
+    }
+    for (const auto& source : sources) {
+        const Region& region = get(source.name);
+        index << source.name << " " << region.page << " " << region.rect.left << " " << region.rect.top << " "
+            << region.rect.width << " " << region.rect.height << "\n";
+    }
+}
@@ -0,0 +1,55 @@
+#ifndef TEXTUREATLAS_HPP
+#define TEXTUREATLAS_HPP
+
+#include <SFML/Graphics.hpp>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Packs many small images into a few large texture pages at startup (skyline bottom-left),
+// so sprites that used separate textures can share one texture bind. Optionally caches the
+// packed pages and layout on disk; the cache is reused while every source file keeps its size
+// and content hash.
+// build() is prepare() followed by upload(). prepare() only works on sf::Images, so it can
+// run on a loader thread; upload() creates the textures and belongs on the main thread.
+class TextureAtlas {
+public:
+    struct Region {
+        int page = 0;
+        sf::IntRect rect;
+    };
+
+    explicit TextureAtlas(unsigned int pageSize = 1024);
+
+    void add(const std::string& name, const std::string& path);
+    bool build(const std::string& cachePrefix = "");
+    bool prepare(const std::string& cachePrefix = "");
+    bool upload();
+
+    bool contains(const std::string& name) const;
+    const Region& get(const std::string& name) const;
+    // An empty texture, with an error, for a page that does not exist (e.g. the atlas failed to build)
+    const sf::Texture& getPage(int page) const;
+    size_t getPageCount() const { return pages.size(); }
+    bool wasLoadedFromCache() const { return loadedFromCache; }
+
+private:
+    struct Source {
+        std::string name;
+        std::string path;
+    };
+
+    unsigned int pageSize;
+    std::vector<Source> sources;
+    std::map<std::string, Region> regions;
+    std::vector<std::unique_ptr<sf::Texture>> pages;
+    std::vector<sf::Image> pendingPages;
+    bool loadedFromCache = false;
+
+    bool pack(std::vector<sf::Image>& pageImages);
+    bool loadCache(const std::string& cachePrefix, std::vector<sf::Image>& pageImages);
+    void saveCache(const std::string& cachePrefix, const std::vector<sf::Image>& pageImages) const;
+};
+
+#endif // TEXTUREATLAS_HPP
@@ -0,0 +1,18 @@
+#ifndef TEXTUREID_HPP
+#define TEXTUREID_HPP
+
+#include <cstdint>
+
+// Textures an entity can be drawn with. Sprites are only assembled from these at render time.
+enum class TextureId : std::uint8_t {
+    Player,
+    Bullet,
+    ZombieBullet,
+    Zombie,
+    PowerUpHealth,
+    PowerUpSpeed,
+    PowerUpDamage,
+    Count
+};
+
+#endif // TEXTUREID_HPP
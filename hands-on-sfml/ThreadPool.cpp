@@ -0,0 +1,67 @@
+#include "ThreadPool.hpp"
+#include "TraceRecorder.hpp"
+
+ThreadPool::ThreadPool(unsigned int workerCount) {
+    workers.reserve(workerCount);
+    for (unsigned int i = 0; i < workerCount; ++i)
+        workers.emplace_back(&ThreadPool::workerLoop, this);
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto& worker : workers)
+        worker.join();
+}
+
+void ThreadPool::run(size_t count, Invoke function, void* functionContext) {
+    if (count == 0) return;
+    if (workers.empty() || count == 1) {
+        for (size_t i = 0; i < count; ++i) function(functionContext, i);
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    invoke = function;
+    context = functionContext;
+    taskCount = count;
+    nextTask = 0;
+    generation++;
+    wake.notify_all();
+
+    runTasks(lock);
+
+    // Every index is claimed; wait for the workers still finishing theirs before the job goes away
+    idle.wait(lock, [this] { return activeWorkers == 0; });
+    invoke = nullptr;
+    context = nullptr;
+}
+
+void ThreadPool::runTasks(std::unique_lock<std::mutex>& lock) {
+    // Tasks are coarse (a chunk of entities each), so one lock per claim costs nothing measurable
+    while (nextTask < taskCount) {
+        size_t index = nextTask++;
+        lock.unlock();
+        invoke(context, index);
+        lock.lock();
+    }
+}
+
+void ThreadPool::workerLoop() {
+    TRACE_THREAD_NAME("pool worker");
+    unsigned int seenGeneration = 0;
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+        wake.wait(lock, [&] { return stopping || generation != seenGeneration; });
+        if (stopping) return;
+        seenGeneration = generation;
+        if (!invoke) continue;
+
+        activeWorkers++;
+        runTasks(lock);
+        if (--activeWorkers == 0) idle.notify_one();
+    }
+}
@@ -0,0 +1,54 @@
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Fixed set of worker threads for data-parallel loops. parallelFor hands out task indices
+// from a shared counter; the calling thread works too and the call returns only once every
+// task has finished. With zero workers everything runs inline on the caller.
+class ThreadPool {
+public:
+    explicit ThreadPool(unsigned int workerCount);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Workers plus the calling thread
+    unsigned int getThreadCount() const { return static_cast<unsigned int>(workers.size()) + 1; }
+
+    // Calls task(i) once for every i in [0, taskCount), in no particular order or thread
+    template <typename Task>
+    void parallelFor(size_t taskCount, Task&& task) {
+        using TaskType = typename std::remove_reference<Task>::type;
+        run(taskCount, [](void* context, size_t index) { (*static_cast<TaskType*>(context))(index); }, &task);
+    }
+
+private:
+    using Invoke = void (*)(void* context, size_t index);
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable idle;
+
+    // Current job; only written under the mutex while no worker is inside it
+    Invoke invoke = nullptr;
+    void* context = nullptr;
+    size_t taskCount = 0;
+    size_t nextTask = 0;
+    unsigned int generation = 0;
+    unsigned int activeWorkers = 0;
+    bool stopping = false;
+
+    void run(size_t count, Invoke function, void* functionContext);
+    void runTasks(std::unique_lock<std::mutex>& lock);
+    void workerLoop();
+};
+
+#endif // THREADPOOL_HPP
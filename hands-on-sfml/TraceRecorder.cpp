@@ -0,0 +1,165 @@
+#include "TraceRecorder.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+namespace {
+    thread_local void* localBuffer = nullptr;
+
+    void writeEscaped(std::ostream& out, const char* text) {
+        out << '"';
+        for (const char* c = text; *c; ++c) {
+            if (*c == '"' || *c == '\\') out << '\\';
+            out << *c;
+        }
+        out << '"';
+    }
+}
+
+TraceRecorder& TraceRecorder::get() {
+    static TraceRecorder recorder;
+    return recorder;
+}
+
+TraceRecorder::TraceRecorder() : epoch(Clock::now()), spikeStart(epoch) {
+}
+
+long long TraceRecorder::sinceEpoch(Clock::time_point time) const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time - epoch).count();
+}
+
+TraceRecorder::ThreadBuffer& TraceRecorder::local() {
+    if (localBuffer) return *static_cast<ThreadBuffer*>(localBuffer);
+
+    // Buffers are never freed before the recorder, so a thread that exits leaves its events behind
+    std::unique_ptr<ThreadBuffer> buffer(new ThreadBuffer());
+    buffer->events.reset(new Event[TRACE_EVENTS_PER_THREAD]);
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+    buffer->id = static_cast<int>(buffers.size()) + 1;
+    buffer->threadName = "thread " + std::to_string(buffer->id);
+    localBuffer = buffer.get();
+    buffers.push_back(std::move(buffer));
+    return *buffers.back();
+}
+
+const char* TraceRecorder::intern(const std::string& name) {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    return internedNames.insert(name).first->c_str();
+}
+
+void TraceRecorder::setThreadName(const char* name) {
+    ThreadBuffer& buffer = local();
+    std::lock_guard<std::mutex> lock(registryMutex);
+    buffer.threadName = name;
+}
+
+void TraceRecorder::append(Phase phase, const char* name, long long start, long long value) {
+    ThreadBuffer& buffer = local();
+    uint64_t index = buffer.written.load(std::memory_order_relaxed);
+    Event& event = buffer.events[index % TRACE_EVENTS_PER_THREAD];
+
+    // Odd while the slot is being rewritten; readers compare the sequence before and after copying
+    event.sequence.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    event.start.store(start, std::memory_order_relaxed);
+    event.value.store(value, std::memory_order_relaxed);
+    event.name.store(name, std::memory_order_relaxed);
+    event.phase.store(static_cast<char>(phase), std::memory_order_relaxed);
+    event.sequence.store(2 * index + 2, std::memory_order_release);
+    buffer.written.store(index + 1, std::memory_order_release);
+}
+
+void TraceRecorder::complete(const char* name, Clock::time_point start, Clock::time_point end) {
+    append(Phase::Complete, name, sinceEpoch(start), std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+void TraceRecorder::counter(const char* name, long long value) {
+    append(Phase::Counter, name, sinceEpoch(Clock::now()), value);
+}
+
+void TraceRecorder::collect(const ThreadBuffer& buffer, long long from, long long to, std::vector<Snapshot>& out) const {
+    uint64_t written = buffer.written.load(std::memory_order_acquire);
+    uint64_t first = written > TRACE_EVENTS_PER_THREAD ? written - TRACE_EVENTS_PER_THREAD : 0;
+
+    for (uint64_t index = first; index < written; ++index) {
+        const Event& event = buffer.events[index % TRACE_EVENTS_PER_THREAD];
+        uint64_t sequence = event.sequence.load(std::memory_order_acquire);
+        if (sequence != 2 * index + 2) continue;
+
+        Snapshot snapshot;
+        snapshot.start = event.start.load(std::memory_order_relaxed);
+        snapshot.value = event.value.load(std::memory_order_relaxed);
+        snapshot.name = event.name.load(std::memory_order_relaxed);
+        snapshot.phase = static_cast<Phase>(event.phase.load(std::memory_order_relaxed));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (event.sequence.load(std::memory_order_relaxed) != sequence) continue;   // overwritten meanwhile
+
+        long long end = snapshot.phase == Phase::Complete ? snapshot.start + snapshot.value : snapshot.start;
+        if (end >= from && snapshot.start <= to) out.push_back(snapshot);
+    }
+}
+
+bool TraceRecorder::writeWindow(const std::string& path, Clock::time_point from, Clock::time_point to) {
+    std::ofstream out(path);
+    if (!out.is_open()) {
+        std::cerr << "Error writing trace to " << path << "!\n";
+        return false;
+    }
+
+    long long fromNs = sinceEpoch(from);
+    long long toNs = sinceEpoch(to);
+    std::vector<Snapshot> events;
+    size_t eventCount = 0;
+    bool first = true;
+
+    // Timestamps are microseconds since the recorder started
+    out << std::fixed << std::setprecision(3);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    std::lock_guard<std::mutex> lock(registryMutex);
+    for (const auto& buffer : buffers) {
+        out << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->id << ",\"args\":{\"name\":";
+        writeEscaped(out, buffer->threadName.c_str());
+        out << "}}";
+        first = false;
+
+        events.clear();
+        collect(*buffer, fromNs, toNs, events);
+        for (const Snapshot& event : events) {
+            out << ",\n{\"name\":";
+            writeEscaped(out, event.name);
+            out << ",\"ph\":\"" << static_cast<char>(event.phase) << "\",\"pid\":1,\"tid\":" << buffer->id
+                << ",\"ts\":" << event.start / 1000.0;
+            if (event.phase == Phase::Complete)
+                out << ",\"dur\":" << event.value / 1000.0 << '}';
+            else
+                out << ",\"args\":{\"value\":" << event.value << "}}";
+        }
+        eventCount += events.size();
+    }
+    out << "\n]}\n";
+
+    std::cout << "Wrote " << eventCount << " trace events to " << path << std::endl;
+    return true;
+}
+
+void TraceRecorder::frameEnded(Clock::time_point frameStart, float frameMs) {
+    if (cooldownFrames > 0) {
+        cooldownFrames--;
+    }
+    else if (framesUntilDump < 0 && frameMs > spikeBudgetMs && dumpsWritten < TRACE_MAX_DUMPS) {
+        // Keep recording a little longer so the trace shows what the spike led into
+        spikeStart = frameStart;
+        framesUntilDump = TRACE_FRAMES_AFTER_SPIKE;
+        std::cout << "Frame took " << frameMs << " ms, writing a trace in " << TRACE_FRAMES_AFTER_SPIKE << " frames" << std::endl;
+    }
+
+    if (framesUntilDump >= 0 && framesUntilDump-- == 0) {
+        auto before = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float, std::milli>(TRACE_WINDOW_BEFORE_MS));
+        writeWindow(std::string(TRACE_DUMP_PREFIX) + "_" + std::to_string(dumpsWritten) + ".json", spikeStart - before, Clock::now());
+        dumpsWritten++;
+        // Writing the file stalls this thread; do not let that stall trigger the next dump
+        cooldownFrames = TRACE_FRAMES_AFTER_SPIKE;
+    }
+}
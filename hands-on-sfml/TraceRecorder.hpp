@@ -0,0 +1,118 @@
+#ifndef TRACERECORDER_HPP
+#define TRACERECORDER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <set>
+#include <string>
+#include <vector>
+#include "Constants.hpp"
+
+// Set to 0 (e.g. in the project's preprocessor definitions) to compile every profiler and
+// trace marker out
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 1
+#endif
+
+// Rolling trace of timed scopes and counters from every thread. Each thread appends to its
+// own ring of TRACE_EVENTS_PER_THREAD events without locking; only the first event from a
+// thread takes a lock, to register its buffer. When a frame runs over the spike budget the
+// recorder waits TRACE_FRAMES_AFTER_SPIKE more frames, then writes everything from
+// TRACE_WINDOW_BEFORE_MS before the spike up to now as Chrome trace-event JSON
+// (chrome://tracing or ui.perfetto.dev). Event names are stored by pointer, so they must
+// outlive the recorder: string literals, or names made at runtime and passed through intern().
+class TraceRecorder {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static TraceRecorder& get();
+
+    // A copy of 'name' that lives as long as the recorder; equal names share one copy
+    const char* intern(const std::string& name);
+    void setThreadName(const char* name);
+    void complete(const char* name, Clock::time_point start, Clock::time_point end);
+    void counter(const char* name, long long value);
+
+    // Called once per frame from the main thread
+    void frameEnded(Clock::time_point frameStart, float frameMs);
+    void setSpikeBudget(float milliseconds) { spikeBudgetMs = milliseconds; }
+
+    bool writeWindow(const std::string& path, Clock::time_point from, Clock::time_point to);
+
+private:
+    enum class Phase : char { Complete = 'X', Counter = 'C' };
+
+    // Fields are relaxed atomics guarded by a per-slot sequence number, so a dump running
+    // while the owner overwrites a slot skips that slot instead of reading a torn event
+    struct Event {
+        std::atomic<uint64_t> sequence{ 0 };
+        std::atomic<long long> start{ 0 };
+        std::atomic<long long> value{ 0 };   // duration in ns, or the counter value
+        std::atomic<const char*> name{ nullptr };
+        std::atomic<char> phase{ 0 };
+    };
+
+    struct ThreadBuffer {
+        std::unique_ptr<Event[]> events;
+        std::atomic<uint64_t> written{ 0 };
+        std::string threadName;   // guarded by registryMutex
+        int id = 0;
+    };
+
+    struct Snapshot {
+        long long start;
+        long long value;
+        const char* name;
+        Phase phase;
+    };
+
+    TraceRecorder();
+
+    Clock::time_point epoch;
+    std::mutex registryMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    std::set<std::string> internedNames;   // guarded by registryMutex; nodes never move
+
+    float spikeBudgetMs = TRACE_SPIKE_BUDGET_MS;
+    Clock::time_point spikeStart;
+    int framesUntilDump = -1;
+    int cooldownFrames = 0;
+    int dumpsWritten = 0;
+
+    ThreadBuffer& local();
+    void append(Phase phase, const char* name, long long start, long long value);
+    void collect(const ThreadBuffer& buffer, long long from, long long to, std::vector<Snapshot>& out) const;
+    long long sinceEpoch(Clock::time_point time) const;
+};
+
+class TraceScope {
+public:
+    explicit TraceScope(const char* name) : name(name), start(TraceRecorder::Clock::now()) {}
+    ~TraceScope() { TraceRecorder::get().complete(name, start, TraceRecorder::Clock::now()); }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* name;
+    TraceRecorder::Clock::time_point start;
+};
+
+// The trace is part of the profiler: PROFILER_ENABLED=0 compiles these out too
+#if PROFILER_ENABLED
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_SCOPE(name) TraceScope TRACE_CONCAT(traceScope, __LINE__)(name)
+#define TRACE_COUNTER(name, value) TraceRecorder::get().counter(name, static_cast<long long>(value))
+#define TRACE_THREAD_NAME(name) TraceRecorder::get().setThreadName(name)
+#else
+#define TRACE_SCOPE(name) ((void)0)
+#define TRACE_COUNTER(name, value) ((void)0)
+#define TRACE_THREAD_NAME(name) ((void)0)
+#endif
+
+#endif // TRACERECORDER_HPP
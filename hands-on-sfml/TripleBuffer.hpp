@@ -0,0 +1,38 @@
+#ifndef TRIPLEBUFFER_HPP
+#define TRIPLEBUFFER_HPP
+
+#include <atomic>
+
+// Hands the newest value from one writer thread to one reader thread without locks or waiting.
+// Each side owns one slot; the third sits in the middle. publish() swaps the writer's slot into
+// the middle and flags it fresh, update() swaps a fresh middle slot out to the reader. Neither
+// side ever touches the slot the other one holds, so a value is never seen half-written, and
+// the writer never waits for a slow reader: unread values are simply overwritten.
+template <typename T>
+class TripleBuffer {
+public:
+    // Writer: fill back(), then publish() it
+    T& back() { return slots[backIndex]; }
+    void publish() {
+        backIndex = middle.exchange(backIndex | FRESH, std::memory_order_acq_rel) & INDEX_MASK;
+    }
+
+    // Reader: update() takes the newest published value if there is one; front() stays valid until the next update()
+    bool update() {
+        if ((middle.load(std::memory_order_relaxed) & FRESH) == 0) return false;
+        frontIndex = middle.exchange(frontIndex, std::memory_order_acq_rel) & INDEX_MASK;
+        return true;
+    }
+    const T& front() const { return slots[frontIndex]; }
+
+private:
+    static const int INDEX_MASK = 3;
+    static const int FRESH = 4;
+
+    T slots[3];
+    int backIndex = 0;
+    int frontIndex = 1;
+    std::atomic<int> middle{ 2 };
+};
+
+#endif // TRIPLEBUFFER_HPP
@@ -0,0 +1,32 @@
+#include "WorldSnapshot.hpp"
+#include "Simulation.hpp"
+
+void WorldSnapshot::capture(const Simulation& sim) {
+    player = sim.player;
+    store = sim.store;
+    zombiesKilled = sim.zombiesKilled;
+    playerDead = sim.isPlayerDead();
+
+    const ChunkWorld& world = sim.world;
+    if (worldVersion != world.getVersion()) {
+        worldVersion = world.getVersion();
+        worldOrigin = world.getOrigin();
+        chunkSize = world.getChunkSize();
+        activeBounds = world.getActiveBounds();
+        obstacles = world.getActiveObstacles();
+        obstacleKinds = world.getActiveObstacleKinds();
+    }
+
+#ifndef NDEBUG
+    stateHash = sim.hashState();
+#endif
+    captured = std::chrono::steady_clock::now();
+}
+
+bool WorldSnapshot::isConsistent() const {
+#ifndef NDEBUG
+    return Simulation::hashEntities(player, store) == stateHash;
+#else
+    return true;
+#endif
+}
@@ -0,0 +1,45 @@
+#ifndef WORLDSNAPSHOT_HPP
+#define WORLDSNAPSHOT_HPP
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "EntityStore.hpp"
+#include "Player.hpp"
+
+class Simulation;
+
+// Everything the renderer and the game-state logic read from the simulation, copied out
+// after a batch of ticks. The simulation thread fills one while the main thread draws another,
+// so neither waits on the other. Copies reuse the slot's storage, so steady state does not allocate.
+struct WorldSnapshot {
+    Player player;
+    EntityStore store;
+    int zombiesKilled = 0;
+    bool playerDead = false;
+
+    // The active window of the world; obstacles are only recopied when its version changes
+    unsigned int worldVersion = 0;
+    sf::Vector2i worldOrigin;
+    float chunkSize = 0.0f;
+    sf::FloatRect activeBounds;
+    std::vector<sf::FloatRect> obstacles;
+    std::vector<int> obstacleKinds;
+
+    long long tick = 0;            // ticks stepped since the simulation started
+    int restarts = 0;              // sim.reset() calls so far, requested or replayed
+    int restartRequests = 0;       // requestRestart() calls serviced so far; several between ticks are one reset
+    bool replayFinished = false;
+    uint64_t stateHash = 0;        // Simulation::hashState() at capture (debug builds, and the end of a replay)
+    float tickMs = 0.0f;           // average cost of the ticks in this batch
+    float carried = 0.0f;          // seconds left in the tick accumulator at capture
+    std::chrono::steady_clock::time_point captured;
+
+    void capture(const Simulation& sim);
+    // Debug check that the copy matches what the simulation held when it was captured
+    bool isConsistent() const;
+};
+
+#endif // WORLDSNAPSHOT_HPP
@@ -0,0 +1,119 @@
+#include "ZombieSystem.hpp"
+#include "Profiler.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // xorshift32: four bytes of state per zombie, and the sequence is identical on every platform
+    uint32_t nextRandom(uint32_t& state) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    void updateZombieRange(ZombieArchetype& zombies, size_t first, size_t last, float deltaTime,
+        sf::Vector2f playerPosition, const StaticCollisionWorld& staticWorld, const FlowField& flowField,
+        std::vector<ZombieShot>& shots) {
+        float step = ZOMBIE_SPEED * deltaTime;
+
+        for (size_t i = first; i < last; ++i) {
+            sf::Vector2f& position = zombies.position[i];
+            zombies.fireTimer[i] += deltaTime;
+
+            // Always face the player, even while walking around something
+            sf::Vector2f toPlayer = playerPosition - position;
+            float angle = std::atan2(toPlayer.y, toPlayer.x) * 180 / 3.14159265f;
+            zombies.rotation[i] = angle + 90;
+
+            // The shared field says which way round the obstacles; (0, 0) means the way is clear
+            sf::Vector2f direction = flowField.directionAt(position);
+            if (direction.x == 0 && direction.y == 0) {
+                float length = std::hypot(toPlayer.x, toPlayer.y);
+                if (length != 0) direction = toPlayer / length;
+            }
+
+            // Free cells are free for the whole zombie, so only steps into a blocked cell need the exact check
+            sf::Vector2f newPosition = position + direction * step;
+            sf::FloatRect newBounds(newPosition, zombies.extent);
+
+            if (flowField.isBlocked(newPosition) && staticWorld.overlaps(newBounds)) {
+                // Try moving in X direction first
+                sf::FloatRect xBounds = newBounds;
+                xBounds.top = position.y;
+                if (!staticWorld.overlaps(xBounds)) {
+                    position.x = newPosition.x;
+                    continue;
+                }
+
+                // Try moving in Y direction if X is blocked
+                sf::FloatRect yBounds = newBounds;
+                yBounds.left = position.x;
+                if (!staticWorld.overlaps(yBounds)) {
+                    position.y = newPosition.y;
+                    continue;
+                }
+
+                // If completely blocked, zombie stops moving
+            }
+            else {
+                position = newPosition;
+            }
+
+            // Zombie shooting logic
+            if (zombies.fireTimer[i] > zombies.fireInterval[i]) {
+                sf::Vector2f bulletDirection = playerPosition - position;
+                float bulletLength = std::hypot(bulletDirection.x, bulletDirection.y);
+                if (bulletLength != 0) bulletDirection /= bulletLength;
+
+                shots.push_back({ position, bulletDirection * BULLET_SPEED * 0.3f });
+
+                zombies.fireTimer[i] = 0.0f;
+                zombies.fireInterval[i] = randomFireInterval(zombies.randomState[i]);
+            }
+        }
+    }
+}
+
+float randomFireInterval(uint32_t& randomState) {
+    return ZOMBIE_FIRE_MIN_INTERVAL +
+        static_cast<float>(nextRandom(randomState) % int((ZOMBIE_FIRE_MAX_INTERVAL - ZOMBIE_FIRE_MIN_INTERVAL) * 1000)) / 1000.0f;
+}
+
+void spawnZombie(ZombieArchetype& zombies, sf::Vector2f position, std::mt19937& rng) {
+    // The zombie's own stream is seeded from the simulation engine; xorshift needs a non-zero state
+    uint32_t randomState = static_cast<uint32_t>(rng()) | 1u;
+    float firstFireInterval = randomFireInterval(randomState);
+    zombies.add(position, firstFireInterval, randomState);
+}
+
+void updateZombies(ZombieArchetype& zombies, float deltaTime, sf::Vector2f playerPosition,
+    ProjectilePool& zombieBullets, const StaticCollisionWorld& staticWorld, const FlowField& flowField,
+    ZombieWorkspace& workspace) {
+    PROFILE_SCOPE("zombies");
+    size_t chunkSize = workspace.chunkSize;
+    size_t chunkCount = (zombies.size() + chunkSize - 1) / chunkSize;
+    if (workspace.shots.size() < chunkCount) workspace.shots.resize(chunkCount);
+
+    // Each chunk only writes its own zombies and its own shot buffer
+    auto updateChunk = [&](size_t chunk) {
+        TRACE_SCOPE("zombie_chunk");
+        size_t first = chunk * chunkSize;
+        size_t last = std::min(zombies.size(), first + chunkSize);
+        workspace.shots[chunk].clear();
+        updateZombieRange(zombies, first, last, deltaTime, playerPosition, staticWorld, flowField, workspace.shots[chunk]);
+    };
+
+    if (workspace.threads) {
+        workspace.threads->parallelFor(chunkCount, updateChunk);
+    }
+    else {
+        for (size_t chunk = 0; chunk < chunkCount; ++chunk) updateChunk(chunk);
+    }
+
+    // Merge in chunk order, so the pool sees the same adds (and drops) as a serial loop would make
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+        for (const ZombieShot& shot : workspace.shots[chunk])
+            zombieBullets.add(shot.position, shot.velocity, PROJECTILE_TTL, TextureId::ZombieBullet);
+    }
+}
@@ -0,0 +1,34 @@
+#ifndef ZOMBIESYSTEM_HPP
+#define ZOMBIESYSTEM_HPP
+
+#include "EntityStore.hpp"
+#include "FlowField.hpp"
+#include "StaticCollisionWorld.hpp"
+#include "ThreadPool.hpp"
+#include "Constants.hpp"
+#include <cstdint>
+#include <random>
+#include <vector>
+
+struct ZombieShot {
+    sf::Vector2f position;
+    sf::Vector2f velocity;
+};
+
+// Scratch state for updateZombies. Zombies are split into fixed chunks of chunkSize;
+// each chunk records its shots in its own buffer, and the buffers are merged into the pool in
+// chunk order afterwards. Chunking never depends on the thread count, so any number of threads
+// (or none) produces the same spawn sequence as a plain serial loop.
+struct ZombieWorkspace {
+    ThreadPool* threads = nullptr;
+    size_t chunkSize = ZOMBIE_UPDATE_CHUNK;   // zombies per task; only the bench changes it
+    std::vector<std::vector<ZombieShot>> shots;
+};
+
+float randomFireInterval(uint32_t& randomState);
+void spawnZombie(ZombieArchetype& zombies, sf::Vector2f position, std::mt19937& rng);
+void updateZombies(ZombieArchetype& zombies, float deltaTime, sf::Vector2f playerPosition,
+    ProjectilePool& zombieBullets, const StaticCollisionWorld& staticWorld, const FlowField& flowField,
+    ZombieWorkspace& workspace);
+
+#endif // ZOMBIESYSTEM_HPP